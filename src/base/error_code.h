@@ -1606,7 +1606,13 @@
 
 #define ER_LOG_UPTODATE_ERROR                       -1247
 
-#define ER_LAST_ERROR                               -1248
+#define ER_LDR_DIRECT_LOAD_NOT_ALLOWED              -1248
+
+#define ER_PB_TORN_PAGE                             -1249
+
+#define ER_PB_PAGE_CHECKSUM_MISMATCH                -1250
+
+#define ER_LAST_ERROR                               -1251
 
 /*
  * CAUTION!
@@ -80,6 +80,7 @@
 #include "heap_file.h"
 #include "vacuum.h"
 #include "xasl_cache.h"
+#include "list_file.h"
 #include "load_worker_manager.hpp"
 
 #if defined (SERVER_MODE)
@@ -210,6 +211,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_IOREADS, "Num_data_page_ioreads"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_IOWRITES, "Num_data_page_iowrites"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_FLUSHED, "Num_data_page_flushed"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_TEMP_NUM_FETCHES, "Num_temp_page_fetches"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_TEMP_NUM_IOREADS, "Num_temp_page_ioreads"),
   /* peeked stats */
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_PRIVATE_QUOTA, "Num_data_page_private_quota"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_PRIVATE_COUNT, "Num_data_page_private_count"),
@@ -294,6 +297,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_MJOINS, "Num_query_mjoins"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_OBJFETCHES, "Num_query_objfetches"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_QM_NUM_HOLDABLE_CURSORS, "Num_query_holdable_cursors"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_TEMP_MEMORY_PAGES, "Num_query_temp_memory_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_TEMP_FILE_SPILLS, "Num_query_temp_file_spills"),
 
   /* Execution statistics for external sort */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_SORT_NUM_IO_PAGES, "Num_sort_io_pages"),
@@ -325,11 +330,22 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_INVALID_XASL_ID, "Num_plan_cache_invalid_xasl_id"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PC_NUM_CACHE_ENTRIES, "Num_plan_cache_entries"),
 
+  /* Execution statistics for Query result cache */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_LOOKUP, "Num_query_cache_lookup"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_HIT, "Num_query_cache_hit"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_MISS, "Num_query_cache_miss"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_STALE, "Num_query_cache_stale"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_EVICT, "Num_query_cache_evict"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_QC_NUM_CACHE_ENTRIES, "Num_query_cache_entries"),
+
   /* Vacuum process log section. */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_VACUUMED_LOG_PAGES, "Num_vacuum_log_pages_vacuumed"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES, "Num_vacuum_log_pages_to_vacuum"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES, "Num_vacuum_prefetch_requests_log_pages"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES, "Num_vacuum_prefetch_hits_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_HEAP_PAGES, "Num_vacuum_heap_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_HEAP_OBJECTS, "Num_vacuum_heap_objects"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_SHARED_HEAP_PAGES, "Num_vacuum_heap_pages_shared"),
 
   /* Track heap modify counters. */
   /* Make a complex entry for heap stats */
@@ -360,6 +376,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_REL_VACUUMS, "Num_heap_rel_vacuums"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_INSID_VACUUMS, "Num_heap_insid_vacuums"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_REMOVE_VACUUMS, "Num_heap_remove_vacuums"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_HEAP_PRUNED_RECORDS, "Num_heap_pruned_records"),
 
   /* Track heap modify timers. */
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_HEAP_INSERT_PREPARE, "heap_insert_prepare"),
@@ -435,14 +452,18 @@ PSTAT_METADATA pstat_Metadata[] = {
 
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_TIME_COUNTERS, "Time_get_snapshot_acquire_time"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS, "Count_get_snapshot_retry"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_REUSE_COUNTERS, "Count_get_snapshot_reuse"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_TRAN_COMPLETE_TIME_COUNTERS, "Time_tran_complete_time"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_OLDEST_MVCC_TIME_COUNTERS, "compute_oldest_visible"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_OLDEST_MVCC_RETRY_COUNTERS, "Count_get_oldest_mvcc_retry"),
 
   /* computed statistics */
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_HIT_RATIO, "Data_page_buffer_hit_ratio"),
+  PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_TEMP_HIT_RATIO, "Temp_page_buffer_hit_ratio"),
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_LOG_HIT_RATIO, "Log_page_buffer_hit_ratio"),
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_VACUUM_DATA_HIT_RATIO, "Vacuum_data_page_buffer_hit_ratio"),
+  PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PC_HIT_RATIO, "Plan_cache_hit_ratio"),
+  PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_QC_HIT_RATIO, "Query_cache_hit_ratio"),
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_VACUUM_EFFICIENCY, "Vacuum_page_efficiency_ratio"),
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_VACUUM_FETCH_RATIO, "Vacuum_page_fetch_ratio"),
 
@@ -1723,11 +1744,24 @@ perfmon_server_calc_stats (UINT64 * stats)
 	       stats[pstat_Metadata[PSTAT_PB_NUM_IOREADS].start_offset]) * 100 * 100,
 	      stats[pstat_Metadata[PSTAT_PB_NUM_FETCHES].start_offset]);
 
+  stats[pstat_Metadata[PSTAT_PB_TEMP_HIT_RATIO].start_offset] =
+    SAFE_DIV ((stats[pstat_Metadata[PSTAT_PB_TEMP_NUM_FETCHES].start_offset] -
+	       stats[pstat_Metadata[PSTAT_PB_TEMP_NUM_IOREADS].start_offset]) * 100 * 100,
+	      stats[pstat_Metadata[PSTAT_PB_TEMP_NUM_FETCHES].start_offset]);
+
   stats[pstat_Metadata[PSTAT_LOG_HIT_RATIO].start_offset] =
     SAFE_DIV ((stats[pstat_Metadata[PSTAT_LOG_NUM_FETCHES].start_offset]
 	       - stats[pstat_Metadata[PSTAT_LOG_NUM_IOREADS].start_offset]) * 100 * 100,
 	      stats[pstat_Metadata[PSTAT_LOG_NUM_FETCHES].start_offset]);
 
+  stats[pstat_Metadata[PSTAT_PC_HIT_RATIO].start_offset] =
+    SAFE_DIV (stats[pstat_Metadata[PSTAT_PC_NUM_HIT].start_offset] * 100 * 100,
+	      stats[pstat_Metadata[PSTAT_PC_NUM_LOOKUP].start_offset]);
+
+  stats[pstat_Metadata[PSTAT_QC_HIT_RATIO].start_offset] =
+    SAFE_DIV (stats[pstat_Metadata[PSTAT_QC_NUM_HIT].start_offset] * 100 * 100,
+	      stats[pstat_Metadata[PSTAT_QC_NUM_LOOKUP].start_offset]);
+
   stats[pstat_Metadata[PSTAT_PB_PAGE_LOCK_ACQUIRE_TIME_10USEC].start_offset] = 100 * lock_time_usec / 1000;
   stats[pstat_Metadata[PSTAT_PB_PAGE_HOLD_ACQUIRE_TIME_10USEC].start_offset] = 100 * hold_time_usec / 1000;
   stats[pstat_Metadata[PSTAT_PB_PAGE_FIX_ACQUIRE_TIME_10USEC].start_offset] = 100 * fix_time_usec / 1000;
@@ -3804,6 +3838,7 @@ perfmon_get_peek_stats (UINT64 * stats)
   /* fixme(rem) - will be fixed in stattool patch */
 #if defined (SERVER_MODE) || defined (SA_MODE)
   stats[pstat_Metadata[PSTAT_PC_NUM_CACHE_ENTRIES].start_offset] = xcache_get_entry_count ();
+  stats[pstat_Metadata[PSTAT_QC_NUM_CACHE_ENTRIES].start_offset] = qfile_get_list_cache_entry_count ();
   stats[pstat_Metadata[PSTAT_HF_NUM_STATS_ENTRIES].start_offset] = heap_get_best_space_num_stats_entries ();
   stats[pstat_Metadata[PSTAT_QM_NUM_HOLDABLE_CURSORS].start_offset] = session_get_number_of_holdable_cursors ();
 #endif /* defined (SERVER_MODE) || defined (SA_MODE) */
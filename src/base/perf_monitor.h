@@ -287,6 +287,8 @@ typedef enum
   PSTAT_PB_NUM_IOREADS,
   PSTAT_PB_NUM_IOWRITES,
   PSTAT_PB_NUM_FLUSHED,
+  PSTAT_PB_TEMP_NUM_FETCHES,
+  PSTAT_PB_TEMP_NUM_IOREADS,
   /* peeked stats */
   PSTAT_PB_PRIVATE_QUOTA,
   PSTAT_PB_PRIVATE_COUNT,
@@ -369,6 +371,8 @@ typedef enum
   PSTAT_QM_NUM_MJOINS,
   PSTAT_QM_NUM_OBJFETCHES,
   PSTAT_QM_NUM_HOLDABLE_CURSORS,
+  PSTAT_QM_NUM_TEMP_MEMORY_PAGES,
+  PSTAT_QM_NUM_TEMP_FILE_SPILLS,
 
   /* Execution statistics for external sort */
   PSTAT_SORT_NUM_IO_PAGES,
@@ -400,10 +404,21 @@ typedef enum
   PSTAT_PC_NUM_INVALID_XASL_ID,
   PSTAT_PC_NUM_CACHE_ENTRIES,
 
+  /* Execution statistics for Query result cache */
+  PSTAT_QC_NUM_LOOKUP,
+  PSTAT_QC_NUM_HIT,
+  PSTAT_QC_NUM_MISS,
+  PSTAT_QC_NUM_STALE,
+  PSTAT_QC_NUM_EVICT,
+  PSTAT_QC_NUM_CACHE_ENTRIES,
+
   PSTAT_VAC_NUM_VACUUMED_LOG_PAGES,
   PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES,
+  PSTAT_VAC_NUM_HEAP_PAGES,
+  PSTAT_VAC_NUM_HEAP_OBJECTS,
+  PSTAT_VAC_NUM_SHARED_HEAP_PAGES,
 
   /* Track heap modify counters. */
   PSTAT_HEAP_HOME_INSERTS,
@@ -433,6 +448,7 @@ typedef enum
   PSTAT_HEAP_REL_VACUUMS,
   PSTAT_HEAP_INSID_VACUUMS,
   PSTAT_HEAP_REMOVE_VACUUMS,
+  PSTAT_HEAP_PRUNED_RECORDS,
 
   /* Track heap modify timers. */
   PSTAT_HEAP_INSERT_PREPARE,
@@ -497,6 +513,7 @@ typedef enum
   /* Log statistics */
   PSTAT_LOG_SNAPSHOT_TIME_COUNTERS,
   PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS,
+  PSTAT_LOG_SNAPSHOT_REUSE_COUNTERS,
   PSTAT_LOG_TRAN_COMPLETE_TIME_COUNTERS,
   PSTAT_LOG_OLDEST_MVCC_TIME_COUNTERS,
   PSTAT_LOG_OLDEST_MVCC_RETRY_COUNTERS,
@@ -504,10 +521,16 @@ typedef enum
   /* Computed statistics */
   /* ((pb_num_fetches - pb_num_ioreads) x 100 / pb_num_fetches) x 100 */
   PSTAT_PB_HIT_RATIO,
+  /* ((pb_temp_num_fetches - pb_temp_num_ioreads) x 100 / pb_temp_num_fetches) x 100 */
+  PSTAT_PB_TEMP_HIT_RATIO,
   /* ((log_num_fetches - log_num_ioreads) x 100 / log_num_fetches) x 100 */
   PSTAT_LOG_HIT_RATIO,
   /* ((fetches of vacuum - fetches of vacuum not found in PB) x 100 / fetches of vacuum) x 100 */
   PSTAT_VACUUM_DATA_HIT_RATIO,
+  /* (pc_num_hit x 100 / pc_num_lookup) x 100 */
+  PSTAT_PC_HIT_RATIO,
+  /* (qc_num_hit x 100 / qc_num_lookup) x 100 */
+  PSTAT_QC_HIT_RATIO,
   /* (100 x Number of unfix with of dirty pages of vacuum / total num of unfixes from vacuum) x 100 */
   PSTAT_PB_VACUUM_EFFICIENCY,
   /* (100 x Number of unfix from vacuum / total num of unfix) x 100 */
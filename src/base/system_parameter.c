@@ -687,6 +687,26 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_USE_STAT_ESTIMATION "use_stat_estimation"
 #define PRM_NAME_IGNORE_TRAILING_SPACE "ignore_trailing_space"
 
+#define PRM_NAME_RECOVERY_PARALLEL_COUNT "recovery_parallel_count"
+
+#define PRM_NAME_LOG_CHECKPOINT_INCREMENTAL "checkpoint_incremental"
+
+#define PRM_NAME_VACUUM_HEAP_PARALLEL_MIN_PAGES "vacuum_heap_parallel_min_pages"
+
+#define PRM_NAME_DWB_ATOMIC_WRITE_SIZE "double_write_buffer_atomic_write_size"
+
+#define PRM_NAME_DWB_WRITERS "double_write_buffer_writers"
+
+#define PRM_NAME_DATA_PAGE_CHECKSUM "data_page_checksum"
+
+#define PRM_NAME_TEMP_FILE_SECTOR_POOL_SIZE "temp_file_sector_pool_size"
+
+#define PRM_NAME_TEMP_FILE_MAX_MEMORY_PAGES "temp_file_max_memory_size_in_pages"
+
+#define PRM_NAME_TEMP_FILE_TOTAL_MEMORY_PAGES "temp_file_total_memory_size_in_pages"
+
+#define PRM_NAME_PB_TEMP_PAGE_RATIO "temp_page_buffer_ratio"
+
 #define PRM_VALUE_DEFAULT "DEFAULT"
 #define PRM_VALUE_MAX "MAX"
 #define PRM_VALUE_MIN "MIN"
@@ -2317,6 +2337,60 @@ bool PRM_IGNORE_TRAILING_SPACE = false;
 static bool prm_ignore_trailing_space_default = false;
 static unsigned int prm_ignore_trailing_space_flag = 0;
 
+int PRM_RECOVERY_PARALLEL_COUNT = 0;
+static int prm_recovery_parallel_count_default = 0;
+static int prm_recovery_parallel_count_upper = 64;
+static int prm_recovery_parallel_count_lower = 0;
+static unsigned int prm_recovery_parallel_count_flag = 0;
+
+bool PRM_LOG_CHECKPOINT_INCREMENTAL = false;
+static bool prm_log_checkpoint_incremental_default = false;
+static unsigned int prm_log_checkpoint_incremental_flag = 0;
+
+int PRM_VACUUM_HEAP_PARALLEL_MIN_PAGES = 256;
+static int prm_vacuum_heap_parallel_min_pages_default = 256;
+static int prm_vacuum_heap_parallel_min_pages_upper = INT_MAX;
+static int prm_vacuum_heap_parallel_min_pages_lower = 0;
+static unsigned int prm_vacuum_heap_parallel_min_pages_flag = 0;
+
+int PRM_DWB_ATOMIC_WRITE_SIZE = 0;
+static int prm_dwb_atomic_write_size_default = 0;
+static int prm_dwb_atomic_write_size_upper = (1024 * 1024);	/* 1M */
+static int prm_dwb_atomic_write_size_lower = 0;
+static unsigned int prm_dwb_atomic_write_size_flag = 0;
+
+int PRM_DWB_WRITERS = 4;
+static int prm_dwb_writers_default = 4;
+static int prm_dwb_writers_upper = 16;
+static int prm_dwb_writers_lower = 1;
+static unsigned int prm_dwb_writers_flag = 0;
+
+bool PRM_DATA_PAGE_CHECKSUM = false;
+static bool prm_data_page_checksum_default = false;
+static unsigned int prm_data_page_checksum_flag = 0;
+
+int PRM_TEMP_FILE_SECTOR_POOL_SIZE = 4;
+static int prm_temp_file_sector_pool_size_default = 4;
+static int prm_temp_file_sector_pool_size_upper = 256;
+static int prm_temp_file_sector_pool_size_lower = 0;
+static unsigned int prm_temp_file_sector_pool_size_flag = 0;
+
+int PRM_TEMP_FILE_MAX_MEMORY_PAGES = 256;
+static int prm_temp_file_max_memory_pages_default = 256;
+static int prm_temp_file_max_memory_pages_lower = 0;
+static unsigned int prm_temp_file_max_memory_pages_flag = 0;
+
+int PRM_TEMP_FILE_TOTAL_MEMORY_PAGES = 8192;
+static int prm_temp_file_total_memory_pages_default = 8192;
+static int prm_temp_file_total_memory_pages_lower = 0;
+static unsigned int prm_temp_file_total_memory_pages_flag = 0;
+
+float PRM_PB_TEMP_PAGE_RATIO = 0.1f;
+static float prm_pb_temp_page_ratio_default = 0.1f;
+static float prm_pb_temp_page_ratio_upper = 0.5f;
+static float prm_pb_temp_page_ratio_lower = 0.0f;
+static unsigned int prm_pb_temp_page_ratio_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -5962,6 +6036,117 @@ static SYSPRM_PARAM prm_Def[] = {
    (void *) NULL, (void *) NULL,
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RECOVERY_PARALLEL_COUNT,
+   PRM_NAME_RECOVERY_PARALLEL_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_recovery_parallel_count_flag,
+   (void *) &prm_recovery_parallel_count_default,
+   (void *) &PRM_RECOVERY_PARALLEL_COUNT,
+   (void *) &prm_recovery_parallel_count_upper, (void *) &prm_recovery_parallel_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_CHECKPOINT_INCREMENTAL,
+   PRM_NAME_LOG_CHECKPOINT_INCREMENTAL,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_log_checkpoint_incremental_flag,
+   (void *) &prm_log_checkpoint_incremental_default,
+   (void *) &PRM_LOG_CHECKPOINT_INCREMENTAL,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_VACUUM_HEAP_PARALLEL_MIN_PAGES,
+   PRM_NAME_VACUUM_HEAP_PARALLEL_MIN_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_vacuum_heap_parallel_min_pages_flag,
+   (void *) &prm_vacuum_heap_parallel_min_pages_default,
+   (void *) &PRM_VACUUM_HEAP_PARALLEL_MIN_PAGES,
+   (void *) &prm_vacuum_heap_parallel_min_pages_upper, (void *) &prm_vacuum_heap_parallel_min_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DWB_ATOMIC_WRITE_SIZE,
+   PRM_NAME_DWB_ATOMIC_WRITE_SIZE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_dwb_atomic_write_size_flag,
+   (void *) &prm_dwb_atomic_write_size_default,
+   (void *) &PRM_DWB_ATOMIC_WRITE_SIZE,
+   (void *) &prm_dwb_atomic_write_size_upper, (void *) &prm_dwb_atomic_write_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DWB_WRITERS,
+   PRM_NAME_DWB_WRITERS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_dwb_writers_flag,
+   (void *) &prm_dwb_writers_default,
+   (void *) &PRM_DWB_WRITERS,
+   (void *) &prm_dwb_writers_upper, (void *) &prm_dwb_writers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DATA_PAGE_CHECKSUM,
+   PRM_NAME_DATA_PAGE_CHECKSUM,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_data_page_checksum_flag,
+   (void *) &prm_data_page_checksum_default,
+   (void *) &PRM_DATA_PAGE_CHECKSUM,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TEMP_FILE_SECTOR_POOL_SIZE,
+   PRM_NAME_TEMP_FILE_SECTOR_POOL_SIZE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_temp_file_sector_pool_size_flag,
+   (void *) &prm_temp_file_sector_pool_size_default,
+   (void *) &PRM_TEMP_FILE_SECTOR_POOL_SIZE,
+   (void *) &prm_temp_file_sector_pool_size_upper, (void *) &prm_temp_file_sector_pool_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TEMP_FILE_MAX_MEMORY_PAGES,
+   PRM_NAME_TEMP_FILE_MAX_MEMORY_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_temp_file_max_memory_pages_flag,
+   (void *) &prm_temp_file_max_memory_pages_default,
+   (void *) &PRM_TEMP_FILE_MAX_MEMORY_PAGES,
+   (void *) NULL, (void *) &prm_temp_file_max_memory_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TEMP_FILE_TOTAL_MEMORY_PAGES,
+   PRM_NAME_TEMP_FILE_TOTAL_MEMORY_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_temp_file_total_memory_pages_flag,
+   (void *) &prm_temp_file_total_memory_pages_default,
+   (void *) &PRM_TEMP_FILE_TOTAL_MEMORY_PAGES,
+   (void *) NULL, (void *) &prm_temp_file_total_memory_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_TEMP_PAGE_RATIO,
+   PRM_NAME_PB_TEMP_PAGE_RATIO,
+   (PRM_FOR_SERVER),
+   PRM_FLOAT,
+   &prm_pb_temp_page_ratio_flag,
+   (void *) &prm_pb_temp_page_ratio_default,
+   (void *) &PRM_PB_TEMP_PAGE_RATIO,
+   (void *) &prm_pb_temp_page_ratio_upper,
+   (void *) &prm_pb_temp_page_ratio_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL}
 };
 
@@ -449,9 +449,19 @@ enum param_id
   PRM_ID_TB_DEFAULT_REUSE_OID,
   PRM_ID_USE_STAT_ESTIMATION,
   PRM_ID_IGNORE_TRAILING_SPACE,
+  PRM_ID_RECOVERY_PARALLEL_COUNT,
+  PRM_ID_LOG_CHECKPOINT_INCREMENTAL,
+  PRM_ID_VACUUM_HEAP_PARALLEL_MIN_PAGES,
+  PRM_ID_DWB_ATOMIC_WRITE_SIZE,
+  PRM_ID_DWB_WRITERS,
+  PRM_ID_DATA_PAGE_CHECKSUM,
+  PRM_ID_TEMP_FILE_SECTOR_POOL_SIZE,
+  PRM_ID_TEMP_FILE_MAX_MEMORY_PAGES,
+  PRM_ID_TEMP_FILE_TOTAL_MEMORY_PAGES,
+  PRM_ID_PB_TEMP_PAGE_RATIO,
 
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_IGNORE_TRAILING_SPACE
+  PRM_LAST_ID = PRM_ID_PB_TEMP_PAGE_RATIO
 };
 typedef enum param_id PARAM_ID;
 
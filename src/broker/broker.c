@@ -198,6 +198,12 @@
 
 #define JOB_COUNT_MAX		1000000
 
+#if defined(LINUX) && defined(SO_REUSEPORT)
+#define MAX_RECEIVER_THREADS	4
+#else
+#define MAX_RECEIVER_THREADS	1
+#endif
+
 /* num of collecting counts per monitoring interval */
 #define NUM_COLLECT_COUNT_PER_INTVL     4
 #define HANG_COUNT_THRESHOLD_RATIO      0.5
@@ -231,6 +237,8 @@ struct t_clt_table
 static void shard_broker_process (void);
 static void cleanup (int signo);
 static int init_env (void);
+static SOCKET open_listen_socket (bool reuse_port);
+static bool is_listen_port_in_use (void);
 #if !defined(WINDOWS)
 static int init_proxy_env (void);
 #endif /* !WINDOWS */
@@ -276,6 +284,7 @@ static int stop_proxy_server (T_PROXY_INFO * proxy_info_p, int br_index, int pro
 static void restart_proxy_server (T_PROXY_INFO * proxy_info_p, int br_index, int proxy_index);
 static SOCKET connect_srv (char *br_name, int as_index);
 static int find_idle_cas (void);
+static void record_dispatch_latency (const T_MAX_HEAP_NODE * job);
 static int find_drop_as_index (void);
 static int find_add_as_index (void);
 static bool broker_add_new_cas (void);
@@ -299,7 +308,10 @@ static int insert_db_server_check_list (T_DB_SERVER * list_p, int check_list_cnt
 static int get_cputime_sec (int pid);
 #endif
 
-static SOCKET sock_fd;
+static SOCKET listen_sock_fd[MAX_RECEIVER_THREADS];
+static int listen_sock_index[MAX_RECEIVER_THREADS];
+static int num_receiver_threads = 1;
+static int job_count = 1;
 static struct sockaddr_in sock_addr;
 static int sock_addr_len;
 #if defined(WINDOWS)
@@ -337,6 +349,7 @@ static int process_flag = 1;
 static int num_busy_uts = 0;
 
 static int max_open_fd = 128;
+static pthread_mutex_t max_open_fd_mutex;	/* max_open_fd is raised by all receiver threads */
 
 #if defined(WIN_FW)
 static int last_job_fetch_time;
@@ -380,6 +393,7 @@ broker_add_new_cas (void)
   shm_appl->as_info[add_as_index].uts_status = UTS_STATUS_IDLE;
   shm_appl->as_info[add_as_index].service_flag = SERVICE_ON;
   shm_appl->as_info[add_as_index].reset_flag = FALSE;
+  broker_shm_push_idle_as (shm_appl, add_as_index);
 
   memset (&shm_appl->as_info[add_as_index].cas_clt_ip[0], 0x0, sizeof (shm_appl->as_info[add_as_index].cas_clt_ip));
   shm_appl->as_info[add_as_index].cas_clt_port = 0;
@@ -479,8 +493,8 @@ main (int argc, char *argv[])
 #if defined(WIN_FW)
   pthread_t service_thread;
   int *thr_index;
-  int i;
 #endif
+  int i;
   int error;
 
   error = broker_init_shm ();
@@ -502,6 +516,7 @@ main (int argc, char *argv[])
   pthread_mutex_init (&clt_table_mutex, NULL);
   pthread_mutex_init (&run_appl_mutex, NULL);
   pthread_mutex_init (&broker_shm_mutex, NULL);
+  pthread_mutex_init (&max_open_fd_mutex, NULL);
   if (br_shard_flag == ON)
     {
       pthread_mutex_init (&run_proxy_mutex, NULL);
@@ -573,7 +588,11 @@ main (int argc, char *argv[])
       SLEEP_MILISEC (0, 200);
     }
 
-  THREAD_BEGIN (receiver_thread, receiver_thr_f, NULL);
+  for (i = 0; i < num_receiver_threads; i++)
+    {
+      listen_sock_index[i] = i;
+      THREAD_BEGIN (receiver_thread, receiver_thr_f, listen_sock_index + i);
+    }
 
   if (br_shard_flag == ON)
     {
@@ -718,13 +737,18 @@ shard_broker_process (void)
 static void
 cleanup (int signo)
 {
+  int i;
+
   signal (signo, SIG_IGN);
 
   process_flag = 0;
 #ifdef SOLARIS
   SLEEP_MILISEC (1, 0);
 #endif
-  CLOSE_SOCKET (sock_fd);
+  for (i = 0; i < num_receiver_threads; i++)
+    {
+      CLOSE_SOCKET (listen_sock_fd[i]);
+    }
   if (br_shard_flag == ON)
     {
 #if !defined(WINDOWS)
@@ -780,7 +804,7 @@ receiver_thr_f (void *arg)
   int job_queue_size;
   T_MAX_HEAP_NODE *job_queue;
   T_MAX_HEAP_NODE new_job;
-  int job_count;
+  SOCKET sock_fd;
   int read_len;
   int one = 1;
   char cas_req_header[SRV_CON_CLIENT_INFO_SIZE];
@@ -793,7 +817,7 @@ receiver_thr_f (void *arg)
 
   job_queue_size = shm_appl->job_queue_size;
   job_queue = shm_appl->job_queue;
-  job_count = 1;
+  sock_fd = listen_sock_fd[*(int *) arg];
 
 #if !defined(WINDOWS)
   signal (SIGPIPE, SIG_IGN);
@@ -1022,15 +1046,16 @@ receiver_thr_f (void *arg)
 	  continue;
 	}
 
+      pthread_mutex_lock (&max_open_fd_mutex);
       if (max_open_fd < clt_sock_fd)
 	{
 	  max_open_fd = clt_sock_fd;
 	}
+      pthread_mutex_unlock (&max_open_fd_mutex);
 
-      job_count = (job_count >= JOB_COUNT_MAX) ? 1 : job_count + 1;
-      new_job.id = job_count;
       new_job.clt_sock_fd = clt_sock_fd;
       new_job.recv_time = time (NULL);
+      gettimeofday (&new_job.recv_tv, NULL);
       new_job.priority = 0;
       new_job.script[0] = '\0';
       new_job.cas_client_type = cas_client_type;
@@ -1043,6 +1068,9 @@ receiver_thr_f (void *arg)
       while (1)
 	{
 	  pthread_mutex_lock (&clt_table_mutex);
+	  /* job ids are shared by all receiver threads */
+	  job_count = (job_count >= JOB_COUNT_MAX) ? 1 : job_count + 1;
+	  new_job.id = job_count;
 	  if (max_heap_insert (job_queue, job_queue_size, &new_job) < 0)
 	    {
 	      pthread_mutex_unlock (&clt_table_mutex);
@@ -1229,6 +1257,7 @@ dispatch_thr_f (void *arg)
       CAS_SEND_ERROR_CODE (cur_job.clt_sock_fd, shm_appl->as_info[as_index].as_port);
       CLOSE_SOCKET (cur_job.clt_sock_fd);
       shm_appl->as_info[as_index].num_request++;
+      record_dispatch_latency (&cur_job);
       shm_appl->as_info[as_index].last_access_time = time (NULL);
       shm_appl->as_info[as_index].transaction_start_time = (time_t) 0;
 #else /* WINDOWS */
@@ -1273,6 +1302,7 @@ dispatch_thr_f (void *arg)
 	  else
 	    {
 	      shm_appl->as_info[as_index].num_request++;
+	      record_dispatch_latency (&cur_job);
 	    }
 	}
       else
@@ -1358,20 +1388,8 @@ init_env (void)
 {
   char *port;
   int n;
-  int one = 1;
+  int i;
 
-  /* get a Unix stream socket */
-  sock_fd = socket (AF_INET, SOCK_STREAM, 0);
-  if (IS_INVALID_SOCKET (sock_fd))
-    {
-      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
-      return (-1);
-    }
-  if ((setsockopt (sock_fd, SOL_SOCKET, SO_REUSEADDR, (char *) &one, sizeof (one))) < 0)
-    {
-      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
-      return (-1);
-    }
   if ((port = getenv (PORT_NUMBER_ENV_STR)) == NULL)
     {
       UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, 0);
@@ -1385,19 +1403,122 @@ init_env (void)
   n = INADDR_ANY;
   memcpy (&sock_addr.sin_addr, &n, sizeof (int));
 
-  if (bind (sock_fd, (struct sockaddr *) &sock_addr, sock_addr_len) < 0)
+  /* With SO_REUSEPORT each receiver thread gets its own listening socket on the broker port and the kernel spreads
+   * incoming connections among them. Fall back to a single socket if the option is not supported. Since another
+   * process could share the port the same way, the option is only set when nobody listens on the port yet. */
+  num_receiver_threads = 1;
+  if (MAX_RECEIVER_THREADS > 1)
+    {
+      if (is_listen_port_in_use ())
+	{
+	  return (-1);
+	}
+
+      listen_sock_fd[0] = open_listen_socket (true);
+      if (!IS_INVALID_SOCKET (listen_sock_fd[0]))
+	{
+	  num_receiver_threads = MAX_RECEIVER_THREADS;
+	}
+    }
+  if (num_receiver_threads == 1)
+    {
+      listen_sock_fd[0] = open_listen_socket (false);
+      if (IS_INVALID_SOCKET (listen_sock_fd[0]))
+	{
+	  return (-1);
+	}
+    }
+
+  for (i = 1; i < num_receiver_threads; i++)
+    {
+      listen_sock_fd[i] = open_listen_socket (true);
+      if (IS_INVALID_SOCKET (listen_sock_fd[i]))
+	{
+	  /* keep serving with the sockets opened so far */
+	  num_receiver_threads = i;
+	  break;
+	}
+    }
+
+  return (0);
+}
+
+/*
+ * is_listen_port_in_use () - check whether another socket, e.g. of a running or stale broker, listens on the port
+ *   return: true if the broker port cannot be bound
+ */
+static bool
+is_listen_port_in_use (void)
+{
+  SOCKET fd;
+  int one = 1;
+  bool in_use = false;
+
+  fd = socket (AF_INET, SOCK_STREAM, 0);
+  if (IS_INVALID_SOCKET (fd))
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
+      return true;
+    }
+
+  /* SO_REUSEADDR ignores connections in TIME_WAIT but not a listening socket */
+  if ((setsockopt (fd, SOL_SOCKET, SO_REUSEADDR, (char *) &one, sizeof (one))) < 0)
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
+      in_use = true;
+    }
+  else if (bind (fd, (struct sockaddr *) &sock_addr, sock_addr_len) < 0)
     {
       UW_SET_ERROR_CODE (UW_ER_CANT_BIND, errno);
-      return (-1);
+      in_use = true;
     }
 
-  if (listen (sock_fd, shm_appl->job_queue_size) < 0)
+  CLOSE_SOCKET (fd);
+  return in_use;
+}
+
+static SOCKET
+open_listen_socket (bool reuse_port)
+{
+  SOCKET fd;
+  int one = 1;
+
+  /* get a Unix stream socket */
+  fd = socket (AF_INET, SOCK_STREAM, 0);
+  if (IS_INVALID_SOCKET (fd))
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
+      return INVALID_SOCKET;
+    }
+  if ((setsockopt (fd, SOL_SOCKET, SO_REUSEADDR, (char *) &one, sizeof (one))) < 0)
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
+      CLOSE_SOCKET (fd);
+      return INVALID_SOCKET;
+    }
+#if defined(SO_REUSEPORT)
+  if (reuse_port && (setsockopt (fd, SOL_SOCKET, SO_REUSEPORT, (char *) &one, sizeof (one))) < 0)
+    {
+      CLOSE_SOCKET (fd);
+      return INVALID_SOCKET;
+    }
+#endif
+
+  if (bind (fd, (struct sockaddr *) &sock_addr, sock_addr_len) < 0)
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_BIND, errno);
+      CLOSE_SOCKET (fd);
+      return INVALID_SOCKET;
+    }
+
+  if (listen (fd, shm_appl->job_queue_size) < 0)
     {
       UW_SET_ERROR_CODE (UW_ER_CANT_BIND, 0);
-      return (-1);
+      CLOSE_SOCKET (fd);
+      return INVALID_SOCKET;
     }
 
-  return (0);
+  return fd;
 }
 
 static int
@@ -1535,6 +1656,9 @@ run_appl_server (T_APPL_SERVER_INFO * as_info_p, int br_index, int as_index)
 #endif
   char as_id_env_str[32];
   char appl_server_shm_key_env_str[32];
+#if !defined(WINDOWS)
+  int last_open_fd;
+#endif
 
   while (1)
     {
@@ -1567,12 +1691,16 @@ run_appl_server (T_APPL_SERVER_INFO * as_info_p, int br_index, int as_index)
       unlink (path);
     }
 
+  pthread_mutex_lock (&max_open_fd_mutex);
+  last_open_fd = max_open_fd;
+  pthread_mutex_unlock (&max_open_fd_mutex);
+
   pid = fork ();
   if (pid == 0)
     {
       signal (SIGCHLD, SIG_DFL);
 
-      for (i = 3; i <= max_open_fd; i++)
+      for (i = 3; i <= last_open_fd; i++)
 	{
 	  close (i);
 	}
@@ -1893,6 +2021,7 @@ cas_monitor_worker (T_APPL_SERVER_INFO * as_info_p, int br_index, int as_index,
 	{
 	  restart_appl_server (as_info_p, br_index, as_index);
 	  as_info_p->uts_status = UTS_STATUS_IDLE;
+	  broker_shm_push_idle_as (shm_appl, as_index);
 	}
       else
 	{
@@ -1903,6 +2032,7 @@ cas_monitor_worker (T_APPL_SERVER_INFO * as_info_p, int br_index, int as_index,
 	{
 	  restart_appl_server (as_info_p, br_index, as_index);
 	  as_info_p->uts_status = UTS_STATUS_IDLE;
+	  broker_shm_push_idle_as (shm_appl, as_index);
 	}
 #endif
     }
@@ -1914,6 +2044,7 @@ cas_monitor_worker (T_APPL_SERVER_INFO * as_info_p, int br_index, int as_index,
 
       as_info_p->pid = new_pid;
       as_info_p->uts_status = UTS_STATUS_IDLE;
+      broker_shm_push_idle_as (shm_appl, as_index);
     }
   else if (br_shard_flag == ON && as_info_p->uts_status == UTS_STATUS_STOP)
     {
@@ -2740,7 +2871,23 @@ find_idle_cas (void)
   wait_cas_id = -1;
   max_wait_time = 0;
 
-  for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num; i++)
+  /* CASes that went idle are queued in shared memory; the queue is only a hint, so every entry is checked again and
+   * the full scan below remains the fallback. */
+  while ((i = broker_shm_pop_idle_as (shm_appl)) >= 0)
+    {
+      if (i < shm_br->br_info[br_index].appl_server_max_num && shm_appl->as_info[i].service_flag == SERVICE_ON
+	  && shm_appl->as_info[i].uts_status == UTS_STATUS_IDLE
+#if !defined (WINDOWS)
+	  && kill (shm_appl->as_info[i].pid, 0) == 0
+#endif
+	)
+	{
+	  idle_cas_id = i;
+	  break;
+	}
+    }
+
+  for (i = 0; idle_cas_id < 0 && i < shm_br->br_info[br_index].appl_server_max_num; i++)
     {
       if (shm_appl->as_info[i].service_flag != SERVICE_ON)
 	{
@@ -2812,6 +2959,34 @@ find_idle_cas (void)
   return idle_cas_id;
 }
 
+/*
+ * record_dispatch_latency () - count a dispatched job in the latency histogram
+ *   return: void
+ *   job(in): job handed over to a CAS
+ */
+static void
+record_dispatch_latency (const T_MAX_HEAP_NODE * job)
+{
+  struct timeval now;
+  INT64 elapsed_msec;
+  INT64 bound;
+  int bucket;
+
+  gettimeofday (&now, NULL);
+  elapsed_msec = ((INT64) (now.tv_sec - job->recv_tv.tv_sec)) * 1000 + (now.tv_usec - job->recv_tv.tv_usec) / 1000;
+
+  /* buckets are < 1, < 10, < 100, < 1000 msec and the rest */
+  for (bucket = 0, bound = 1; bucket < DISPATCH_LATENCY_HIST_SIZE - 1; bucket++, bound *= 10)
+    {
+      if (elapsed_msec < bound)
+	{
+	  break;
+	}
+    }
+
+  shm_appl->dispatch_latency_hist[bucket]++;
+}
+
 static int
 find_drop_as_index (void)
 {
@@ -3186,6 +3361,7 @@ run_proxy_server (T_PROXY_INFO * proxy_info_p, int br_index, int proxy_index)
 #if !defined(WINDOWS)
   char process_name[APPL_SERVER_NAME_MAX_SIZE];
   int i;
+  int last_open_fd;
 #endif
 
   while (1)
@@ -3214,12 +3390,16 @@ run_proxy_server (T_PROXY_INFO * proxy_info_p, int br_index, int proxy_index)
 #if !defined(WINDOWS)
   unlink (proxy_info_p->port_name);
 
+  pthread_mutex_lock (&max_open_fd_mutex);
+  last_open_fd = max_open_fd;
+  pthread_mutex_unlock (&max_open_fd_mutex);
+
   pid = fork ();
   if (pid == 0)
     {
       signal (SIGCHLD, SIG_DFL);
 
-      for (i = 3; i <= max_open_fd; i++)
+      for (i = 3; i <= last_open_fd; i++)
 	{
 	  close (i);
 	}
@@ -2256,6 +2256,26 @@ admin_conf_change (int master_shm_id, const char *br_name, const char *conf_name
       br_info_p->session_timeout = session_timeout;
       shm_as_p->session_timeout = session_timeout;
     }
+  else if (strcasecmp (conf_name, "SERVER_CONNECTION_IDLE_TIMEOUT") == 0)
+    {
+      int idle_timeout = 0;
+
+      idle_timeout = (int) ut_time_string_to_sec ((char *) conf_value, "sec");
+      if (idle_timeout < 0)
+	{
+	  sprintf (admin_err_msg, "invalid value : %s", conf_value);
+	  goto set_conf_error;
+	}
+
+      if (br_info_p->server_connection_idle_timeout == idle_timeout)
+	{
+	  sprintf (admin_err_msg, "same as previous value : %s", conf_value);
+	  goto set_conf_error;
+	}
+
+      br_info_p->server_connection_idle_timeout = idle_timeout;
+      shm_as_p->server_connection_idle_timeout = idle_timeout;
+    }
   else if (strcasecmp (conf_name, "ERROR_LOG_DIR") == 0)
     {
       char *err_log_dir = (char *) conf_value;
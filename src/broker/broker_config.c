@@ -57,6 +57,7 @@
 
 #define DEFAULT_ADMIN_LOG_FILE		"log/broker/cubrid_broker.log"
 #define DEFAULT_SESSION_TIMEOUT		"5min"
+#define DEFAULT_SERVER_CONNECTION_IDLE_TIMEOUT	"0"
 #define DEFAULT_MAX_QUERY_TIMEOUT       "0"
 #define DEFAULT_MYSQL_READ_TIMEOUT      "0"
 #define DEFAULT_MYSQL_KEEPALIVE_INTERVAL	"1800"	/* 30m */
@@ -493,6 +494,16 @@ broker_config_read_internal (const char *conf_file, T_BROKER_INFO * br_info, int
 	  goto conf_error;
 	}
 
+      strncpy_bufsize (time_str,
+		       ini_getstr (ini, sec_name, "SERVER_CONNECTION_IDLE_TIMEOUT",
+				   DEFAULT_SERVER_CONNECTION_IDLE_TIMEOUT, &lineno));
+      br_info[num_brs].server_connection_idle_timeout = (int) ut_time_string_to_sec (time_str, "sec");
+      if (br_info[num_brs].server_connection_idle_timeout < 0)
+	{
+	  errcode = PARAM_BAD_VALUE;
+	  goto conf_error;
+	}
+
       ini_string = ini_getstr (ini, sec_name, "LOG_DIR", DEFAULT_LOG_DIR, &lineno);
       MAKE_FILEPATH (br_info[num_brs].log_dir, ini_string, CONF_LOG_FILE_LEN);
       ini_string = ini_getstr (ini, sec_name, "SLOW_LOG_DIR", DEFAULT_SLOW_LOG_DIR, &lineno);
@@ -1212,6 +1223,7 @@ broker_config_dump (FILE * fp, const T_BROKER_INFO * br_info, int num_broker, in
       fprintf (fp, "SSL\t\t\t=%s\n", br_info[i].use_SSL ? "ON" : "OFF");
       fprintf (fp, "APPL_SERVER_MAX_SIZE\t=%d\n", br_info[i].appl_server_max_size / ONE_K);
       fprintf (fp, "SESSION_TIMEOUT\t\t=%d\n", br_info[i].session_timeout);
+      fprintf (fp, "SERVER_CONNECTION_IDLE_TIMEOUT\t=%d\n", br_info[i].server_connection_idle_timeout);
       fprintf (fp, "LOG_DIR\t\t\t=%s\n", br_info[i].log_dir);
       fprintf (fp, "SLOW_LOG_DIR\t\t=%s\n", br_info[i].slow_log_dir);
       fprintf (fp, "ERROR_LOG_DIR\t\t=%s\n", br_info[i].err_log_dir);
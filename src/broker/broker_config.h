@@ -196,6 +196,7 @@ struct t_broker_info
   int appl_server_max_size;
   int appl_server_hard_limit;
   int session_timeout;
+  int server_connection_idle_timeout;	/* sec, 0 keeps idle CAS connected */
   int query_timeout;
   int mysql_read_timeout;
   int mysql_keepalive_interval;
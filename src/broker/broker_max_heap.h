@@ -40,6 +40,7 @@ struct t_max_heap_node
   int priority;
   SOCKET clt_sock_fd;
   time_t recv_time;
+  struct timeval recv_tv;	/* accept time, for dispatch latency */
   unsigned char ip_addr[4];
   unsigned short port;
   char script[PRE_SEND_SCRIPT_SIZE];
@@ -146,6 +146,7 @@ typedef enum
   FIELD_SHARD_Q_SIZE,
   FIELD_STMT_POOL_RATIO,
   FIELD_NUMBER_OF_CONNECTION_REJECTED,
+  FIELD_DISPATCH_LATENCY,
   FIELD_UNUSABLE_DATABASES,
   FIELD_LAST = FIELD_UNUSABLE_DATABASES
 } FIELD_NAME;
@@ -246,6 +247,13 @@ struct status_field fields[FIELD_LAST + 1] = {
   {FIELD_SHARD_Q_SIZE, 7, "SHARD-Q", FIELD_RIGHT_ALIGN},
   {FIELD_STMT_POOL_RATIO, 20, "STMT-POOL-RATIO(%)", FIELD_RIGHT_ALIGN},
   {FIELD_NUMBER_OF_CONNECTION_REJECTED, 9, "#REJECT", FIELD_RIGHT_ALIGN},
+  /*
+   * number of dispatched connections by the time from accept to CAS hand-off
+   * output example :
+   *    [< 1ms]/[< 10ms]/[< 100ms]/[< 1s]/[others]
+   *    1024/30/2/0/0
+   * */
+  {FIELD_DISPATCH_LATENCY, 40, "DISPATCH(<1/<10/<100/<1000/MS)", FIELD_RIGHT_ALIGN},
   {FIELD_UNUSABLE_DATABASES, 100, "UNUSABLE_DATABASES", FIELD_LEFT_ALIGN}
 };
 
@@ -1245,6 +1253,10 @@ print_monitor_header (MONITOR_TYPE mnt_type)
     {
       buf_offset = print_title (buf, buf_offset, FIELD_NUMBER_OF_CONNECTION, NULL);
       buf_offset = print_title (buf, buf_offset, FIELD_NUMBER_OF_CONNECTION_REJECTED, NULL);
+      if (full_info_flag)
+	{
+	  buf_offset = print_title (buf, buf_offset, FIELD_DISPATCH_LATENCY, NULL);
+	}
     }
   else if (mnt_type == MONITOR_T_SHARDDB)
     {
@@ -1568,6 +1580,13 @@ print_monitor_items (BR_MONITORING_ITEM * mnt_items_cur, BR_MONITORING_ITEM * mn
 	{
 	  print_value (FIELD_NUMBER_OF_CONNECTION, &mnt_item_cur_p->num_connect, FIELD_T_UINT64);
 	  print_value (FIELD_NUMBER_OF_CONNECTION_REJECTED, &mnt_item_cur_p->num_connect_reject, FIELD_T_UINT64);
+	  if (full_info_flag)
+	    {
+	      sprintf (buf, "%lld/%lld/%lld/%lld/%lld", (long long) shm_appl->dispatch_latency_hist[0],
+		       (long long) shm_appl->dispatch_latency_hist[1], (long long) shm_appl->dispatch_latency_hist[2],
+		       (long long) shm_appl->dispatch_latency_hist[3], (long long) shm_appl->dispatch_latency_hist[4]);
+	      print_value (FIELD_DISPATCH_LATENCY, buf, FIELD_T_STRING);
+	    }
 	}
       else if (mnt_type == MONITOR_T_SHARDDB)
 	{
@@ -55,6 +55,8 @@
 
 #define 	SHMODE			0644
 
+#define IDLE_AS_QUEUE_POP_RETRY		100
+
 
 #if defined(WINDOWS)
 static int shm_id_cmp_func (void *key1, void *key2);
@@ -497,6 +499,14 @@ broker_shm_initialize_shm_as (T_BROKER_INFO * br_info_p, T_SHM_PROXY * shm_proxy
   shm_as_p->monitor_server_flag = br_info_p->monitor_server_flag;
   memset (shm_as_p->unusable_databases_cnt, 0, sizeof (shm_as_p->unusable_databases_cnt));
 
+  shm_as_p->idle_as_queue_head = 0;
+  shm_as_p->idle_as_queue_tail = 0;
+  for (as_index = 0; as_index < IDLE_AS_QUEUE_SIZE; as_index++)
+    {
+      shm_as_p->idle_as_queue[as_index] = -1;
+    }
+  memset (shm_as_p->dispatch_latency_hist, 0, sizeof (shm_as_p->dispatch_latency_hist));
+
   strcpy (shm_as_p->log_dir, br_info_p->log_dir);
   strcpy (shm_as_p->slow_log_dir, br_info_p->slow_log_dir);
   strcpy (shm_as_p->err_log_dir, br_info_p->err_log_dir);
@@ -511,6 +521,7 @@ broker_shm_initialize_shm_as (T_BROKER_INFO * br_info_p, T_SHM_PROXY * shm_proxy
   shm_as_p->appl_server_max_size = br_info_p->appl_server_max_size;
   shm_as_p->appl_server_hard_limit = br_info_p->appl_server_hard_limit;
   shm_as_p->session_timeout = br_info_p->session_timeout;
+  shm_as_p->server_connection_idle_timeout = br_info_p->server_connection_idle_timeout;
   shm_as_p->sql_log2 = br_info_p->sql_log2;
   shm_as_p->slow_log_mode = br_info_p->slow_log_mode;
 #if defined(WINDOWS)
@@ -611,6 +622,75 @@ broker_shm_initialize_shm_as (T_BROKER_INFO * br_info_p, T_SHM_PROXY * shm_proxy
   return shm_as_p;
 }
 
+/*
+ * broker_shm_push_idle_as () - tell the broker dispatcher that an application server became idle
+ *   return: void
+ *   shm_as_p(in):
+ *   as_index(in): index of the application server in shm_as_p->as_info
+ *
+ * Note: The queue is shared by all the application servers of the broker and never blocks them. A slot may be
+ *       overwritten before the dispatcher pops it, so the dispatcher still falls back to scanning as_info.
+ */
+void
+broker_shm_push_idle_as (T_SHM_APPL_SERVER * shm_as_p, int as_index)
+{
+#if defined (HAVE_ATOMIC_BUILTINS)
+  unsigned int pos;
+
+  pos = ATOMIC_INC_32 (&shm_as_p->idle_as_queue_tail, 1) - 1;
+  shm_as_p->idle_as_queue[pos & (IDLE_AS_QUEUE_SIZE - 1)] = as_index;
+#endif /* HAVE_ATOMIC_BUILTINS */
+}
+
+/*
+ * broker_shm_pop_idle_as () - get an application server which became idle lately
+ *   return: index of the application server, or -1 if there is none
+ *   shm_as_p(in):
+ *
+ * Note: Only the dispatcher of the broker pops the queue. The returned server may be already busy again.
+ */
+int
+broker_shm_pop_idle_as (T_SHM_APPL_SERVER * shm_as_p)
+{
+  unsigned int head, tail, pos;
+  int as_index = -1;
+  int retry;
+
+  head = shm_as_p->idle_as_queue_head;
+  tail = shm_as_p->idle_as_queue_tail;
+
+  if (tail - head > IDLE_AS_QUEUE_SIZE)
+    {
+      /* the oldest entries were overwritten */
+      head = tail - IDLE_AS_QUEUE_SIZE;
+    }
+
+  for (; head != tail; head++)
+    {
+      pos = head & (IDLE_AS_QUEUE_SIZE - 1);
+
+      /* the server which reserved this slot may not have filled it yet */
+      for (retry = 0; (as_index = shm_as_p->idle_as_queue[pos]) < 0 && retry < IDLE_AS_QUEUE_POP_RETRY; retry++)
+	{
+	  ;
+	}
+
+      if (as_index >= 0)
+	{
+	  shm_as_p->idle_as_queue[pos] = -1;
+	  head++;
+	  break;
+	}
+
+      /* the server died before filling the slot or the slot was overwritten; skip it so the queue does not stay
+       * stuck on it */
+    }
+
+  shm_as_p->idle_as_queue_head = head;
+
+  return as_index;
+}
+
 static void
 broker_shm_set_as_info (T_SHM_APPL_SERVER * shm_appl, T_APPL_SERVER_INFO * as_info_p, T_BROKER_INFO * br_info_p,
 			int as_index)
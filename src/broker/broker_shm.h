@@ -137,6 +137,11 @@
 
 #define APPL_SERVER_NUM_LIMIT    4096
 
+#define IDLE_AS_QUEUE_SIZE       (APPL_SERVER_NUM_LIMIT)	/* power of 2 */
+
+/* dispatch latency histogram buckets: < 1, < 10, < 100, < 1000 msec and the rest */
+#define DISPATCH_LATENCY_HIST_SIZE  5
+
 #define SHM_BROKER_PATH_MAX      (PATH_MAX)
 #define SHM_PROXY_NAME_MAX       (SHM_BROKER_PATH_MAX)
 #define SHM_APPL_SERVER_NAME_MAX (SHM_BROKER_PATH_MAX)
@@ -612,6 +617,7 @@ struct t_shm_appl_server
   int appl_server_max_size;
   int appl_server_hard_limit;
   int session_timeout;
+  int server_connection_idle_timeout;
   int query_timeout;
   int mysql_read_timeout;
   int mysql_keepalive_interval;
@@ -639,6 +645,14 @@ struct t_shm_appl_server
 
   T_SHARD_CONN_INFO shard_conn_info[SHARD_INFO_SIZE_LIMIT];	/* it is used only in shard */
 
+  /* indexes of application servers which became idle. pushed by the application servers and popped by the broker
+   * dispatcher; an entry is only a hint, the dispatcher checks the status of the server again */
+  volatile unsigned int idle_as_queue_head;
+  volatile unsigned int idle_as_queue_tail;
+  volatile int idle_as_queue[IDLE_AS_QUEUE_SIZE];
+
+  INT64 dispatch_latency_hist[DISPATCH_LATENCY_HIST_SIZE];
+
   T_APPL_SERVER_INFO as_info[APPL_SERVER_NUM_LIMIT];
 
   T_DB_SERVER unusable_databases[PAIR_LIST][UNUSABLE_DATABASE_MAX];
@@ -691,5 +705,7 @@ int uw_sem_destroy (sem_t * sem_t);
 T_SHM_BROKER *broker_shm_initialize_shm_broker (int master_shm_id, T_BROKER_INFO * br_info, int br_num, int acl_flag,
 						char *acl_file);
 T_SHM_APPL_SERVER *broker_shm_initialize_shm_as (T_BROKER_INFO * br_info_p, T_SHM_PROXY * shm_proxy_p);
+void broker_shm_push_idle_as (T_SHM_APPL_SERVER * shm_as_p, int as_index);
+int broker_shm_pop_idle_as (T_SHM_APPL_SERVER * shm_as_p);
 
 #endif /* _BROKER_SHM_H_ */
@@ -890,6 +890,16 @@ cas_main (void)
 	cas_info[CAS_INFO_STATUS] = CAS_INFO_STATUS_INACTIVE;
 
 	unset_hang_check_time ();
+
+	/* An idle CAS gives its server connection (and transaction slot) back after a while, so the number of server
+	 * connections follows the active clients. It connects again when the next client arrives. */
+	if (shm_appl->server_connection_idle_timeout > 0 && cas_get_db_connect_status () == 1
+	    && net_wait_client (srv_sock_fd, shm_appl->server_connection_idle_timeout) == 0)
+	  {
+	    ux_database_shutdown ();
+	    cas_set_db_connect_status (-1);	/* DB_CONNECTION_STATUS_RESET */
+	  }
+
 	br_sock_fd = net_connect_client (srv_sock_fd);
 
 	if (IS_INVALID_SOCKET (br_sock_fd))
@@ -1380,6 +1390,7 @@ cas_main (void)
 	    else
 	      {
 		as_info->uts_status = UTS_STATUS_IDLE;
+		broker_shm_push_idle_as (shm_appl, shm_as_index);
 	      }
 	  }
       }
@@ -1633,6 +1644,7 @@ cas_free (bool from_sighandler)
   cas_log_write_and_end (0, true, "CAS TERMINATED pid %d", getpid ());
   cas_log_close (true);
   cas_slow_log_close ();
+  cas_log_final ();
 #if defined(CAS_FOR_ORACLE) || defined(CAS_FOR_MYSQL)
   cas_error_log_close (true);
 #endif
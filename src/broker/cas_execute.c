@@ -83,6 +83,9 @@
 
 #define QUERY_BUFFER_MAX                4096
 
+/* upper bound of a fetch reply grown to hold the rows the client asked for */
+#define FETCH_MAX_NET_BUF_SIZE		(256 * NET_BUF_KBYTE)
+
 #define FK_INFO_SORT_BY_PKTABLE_NAME	1
 #define FK_INFO_SORT_BY_FKTABLE_NAME	2
 
@@ -2180,6 +2183,9 @@ ux_execute_array (T_SRV_HANDLE * srv_handle, int argc, void **argv, T_NET_BUF *
   int res_count;
   int num_query;
   int num_query_msg_offset;
+  int num_array_rows, num_array_done = 0;
+  int array_err_code = NO_ERROR;
+  int *array_counts = NULL;
   char is_prepared;
   char *err_msg;
   DB_SESSION *session = NULL;
@@ -2243,10 +2249,60 @@ ux_execute_array (T_SRV_HANDLE * srv_handle, int argc, void **argv, T_NET_BUF *
 
   first_value = 0;
 
+  /* send the rows of a prepared statement to the server at once; the rows it leaves are executed one by one below */
+  num_array_rows = num_bind / num_markers;
+  if (is_prepared == TRUE && srv_handle->auto_commit_mode == FALSE && num_array_rows > 1)
+    {
+      array_counts = (int *) MALLOC (sizeof (int) * num_array_rows);
+      if (array_counts != NULL)
+	{
+#if !defined (LIBCAS_FOR_JSP) && !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+	  (void) db_set_statement_auto_commit (session, false);
+#endif /* !LIBCAS_FOR_JSP && !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
+
+	  SQL_LOG2_EXEC_BEGIN (as_info->cur_sql_log2, stmt_id);
+	  array_err_code =
+	    db_execute_statement_array (session, stmt_id, num_array_rows, value_list, array_counts, &num_array_done);
+	  SQL_LOG2_EXEC_END (as_info->cur_sql_log2, stmt_id, num_array_done);
+
+	  if (num_array_done > 0 || array_err_code < 0)
+	    {
+	      stmt_type = db_get_statement_type (session, stmt_id);
+	    }
+	}
+    }
+
   while (num_bind >= num_markers)
     {
       num_query++;
 
+      if (num_query <= num_array_done)
+	{
+	  /* executed by db_execute_statement_array () */
+#ifndef LIBCAS_FOR_JSP
+	  update_query_execution_count (as_info, stmt_type);
+#endif /* LIBCAS_FOR_JSP */
+
+	  /* only server-side inserts are executed this way, and the server does not return their objects, so the
+	   * OID is reported as not available, the same as a row-by-row server-side insert reports it */
+	  dbobj_to_casobj (NULL, &ins_oid);
+	  net_buf_cp_int (net_buf, array_counts[num_query - 1], NULL);
+	  net_buf_cp_object (net_buf, &ins_oid);
+
+	  num_bind -= num_markers;
+	  first_value += num_markers;
+	  continue;
+	}
+      else if (num_query == num_array_done + 1 && array_err_code < 0)
+	{
+	  /* this row failed in db_execute_statement_array (); its error is still set */
+#ifndef LIBCAS_FOR_JSP
+	  update_query_execution_count (as_info, stmt_type);
+#endif /* LIBCAS_FOR_JSP */
+	  array_err_code = NO_ERROR;
+	  goto exec_db_error;
+	}
+
       if (is_prepared == FALSE)
 	{
 	  session = db_open_buffer (srv_handle->sql_stmt);
@@ -2400,6 +2456,11 @@ ux_execute_array (T_SRV_HANDLE * srv_handle, int argc, void **argv, T_NET_BUF *
 
   net_buf_overwrite_int (net_buf, num_query_msg_offset, num_query);
 
+  if (array_counts)
+    {
+      FREE_MEM (array_counts);
+    }
+
   if (value_list)
     {
       for (i = 0; i < num_bind; i++)
@@ -2427,6 +2488,11 @@ execute_array_error:
   NET_BUF_ERR_SET (net_buf);
   errors_in_transaction++;
 
+  if (array_counts)
+    {
+      FREE_MEM (array_counts);
+    }
+
   if (srv_handle->prepare_flag & CCI_PREPARE_XASL_CACHE_PINNED)
     {
       db_session_set_xasl_cache_pinned (session, false, false);
@@ -5309,6 +5375,7 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
   int num_tuple_msg_offset;
   int num_tuple;
   int net_buf_size;
+  int fetch_start_size;
   char fetch_end_flag = 0;
   DB_QUERY_RESULT *result;
   T_QUERY_RESULT *q_result;
@@ -5403,6 +5470,8 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
       net_buf_size = NET_BUF_SIZE;
     }
 
+  fetch_start_size = NET_BUF_CURR_SIZE (net_buf);
+
   num_tuple = 0;
   while (CHECK_NET_BUF_SIZE (net_buf, net_buf_size))
     {				/* currently, don't check fetch_count */
@@ -5451,6 +5520,19 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
 
       num_tuple++;
       cursor_pos++;
+
+      if (num_tuple == 1 && cas_shard_flag == OFF)
+	{
+	  /* size the reply from the width of the first row so that wide rows still come fetch_count at a time and
+	   * a large export needs fewer round trips */
+	  INT64 wanted_size = (INT64) (NET_BUF_CURR_SIZE (net_buf) - fetch_start_size) * fetch_count + fetch_start_size;
+
+	  if (wanted_size > net_buf_size)
+	    {
+	      net_buf_size = (int) MIN (wanted_size, FETCH_MAX_NET_BUF_SIZE);
+	    }
+	}
+
       if (srv_handle->max_row > 0 && cursor_pos > srv_handle->max_row)
 	{
 	  if (check_auto_commit_after_getting_result (srv_handle) == true)
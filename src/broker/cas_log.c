@@ -37,6 +37,7 @@
 #else
 #include <unistd.h>
 #include <sys/time.h>
+#include <pthread.h>
 #endif
 #include <assert.h>
 
@@ -62,6 +63,7 @@ typedef int mode_t;
 
 #define CAS_LOG_BUFFER_SIZE (8192)
 #define SQL_LOG_BUFFER_SIZE 163840
+#define CAS_LOG_FLUSH_INTERVAL_MSEC 200
 #define ACCESS_LOG_IS_DENIED_TYPE(T)  ((T)==ACL_REJECTED)
 
 static const char *get_access_log_type_string (ACCESS_LOG_TYPE type);
@@ -93,6 +95,27 @@ static FILE *log_fp = NULL, *slow_log_fp = NULL;
 static char log_filepath[BROKER_PATH_MAX], slow_log_filepath[BROKER_PATH_MAX];
 static INT64 saved_log_fpos = 0;
 
+/* SQL_LOG_MODE_ALL and the slow log used to fflush on every write. The writes now only fill the stdio buffer
+ * and the flusher thread pushes the dirty streams to the file, so the request path does not wait for disk.
+ * The thread is started by the first log open and runs until the CAS process ends (cas_log_final). */
+static bool cas_log_flusher_started = false;
+static bool cas_log_flush_mutex_initialized = false;
+static pthread_mutex_t cas_log_flush_mutex;
+static pthread_cond_t cas_log_flush_cond;
+static bool log_fp_dirty = false, slow_log_fp_dirty = false;	/* protected by cas_log_flush_mutex */
+static bool cas_log_flusher_exit = false;	/* asks the flusher thread to stop */
+static bool cas_log_flusher_running = false;	/* cleared by the flusher thread when it stops */
+#if !defined(WINDOWS)
+static pthread_t cas_log_flusher_thread;
+#endif /* !WINDOWS */
+
+#ifndef LIBCAS_FOR_JSP
+static void cas_log_start_flusher (void);
+static void cas_log_stop_flusher (void);
+static THREAD_FUNC cas_log_flusher_thr_f (void *arg);
+#endif /* !LIBCAS_FOR_JSP */
+static void cas_log_request_flush (FILE * fp);
+
 static size_t cas_fwrite (const void *ptr, size_t size, size_t nmemb, FILE * stream);
 static INT64 cas_ftell (FILE * stream);
 static int cas_fseek (FILE * stream, INT64 offset, int whence);
@@ -197,6 +220,7 @@ cas_log_open (char *br_name)
       if (log_fp)
 	{
 	  setvbuf (log_fp, sql_log_buffer, _IOFBF, SQL_LOG_BUFFER_SIZE);
+	  cas_log_start_flusher ();
 	}
     }
   else
@@ -237,6 +261,10 @@ cas_log_close (bool flag)
 #ifndef LIBCAS_FOR_JSP
   if (log_fp != NULL)
     {
+      if (cas_log_flusher_started)
+	{
+	  pthread_mutex_lock (&cas_log_flush_mutex);
+	}
       if (flag)
 	{
 	  cas_fseek (log_fp, saved_log_fpos, SEEK_SET);
@@ -244,11 +272,28 @@ cas_log_close (bool flag)
 	}
       cas_fclose (log_fp);
       log_fp = NULL;
+      log_fp_dirty = false;
       saved_log_fpos = 0;
+      if (cas_log_flusher_started)
+	{
+	  pthread_mutex_unlock (&cas_log_flush_mutex);
+	}
     }
 #endif /* LIBCAS_FOR_JSP */
 }
 
+/*
+ * cas_log_final () - stop the log flusher thread when the CAS process ends
+ *   return: void
+ */
+void
+cas_log_final (void)
+{
+#ifndef LIBCAS_FOR_JSP
+  cas_log_stop_flusher ();
+#endif /* LIBCAS_FOR_JSP */
+}
+
 static void
 cas_log_backup (T_CUBRID_FILE_ID fid)
 {
@@ -279,6 +324,169 @@ cas_log_backup (T_CUBRID_FILE_ID fid)
   cas_rename (filepath, backup_filepath);
 }
 
+#ifndef LIBCAS_FOR_JSP
+/*
+ * cas_log_start_flusher () - start the thread flushing the sql and slow logs in the background
+ *   return: void
+ *
+ * note: when the thread cannot be started, writes keep flushing synchronously.
+ */
+static void
+cas_log_start_flusher (void)
+{
+  if (cas_log_flusher_started)
+    {
+      return;
+    }
+
+  if (!cas_log_flush_mutex_initialized)
+    {
+      pthread_mutex_init (&cas_log_flush_mutex, NULL);
+      pthread_cond_init (&cas_log_flush_cond, NULL);
+      cas_log_flush_mutex_initialized = true;
+    }
+
+  cas_log_flusher_exit = false;
+  cas_log_flusher_running = true;
+#if defined(WINDOWS)
+  {
+    pthread_t flusher_thread;
+
+    /* the handle of _beginthread cannot be waited for; cas_log_stop_flusher waits on cas_log_flusher_running */
+    THREAD_BEGIN (flusher_thread, cas_log_flusher_thr_f, NULL);
+    if (flusher_thread == (pthread_t) (-1))
+      {
+	cas_log_flusher_running = false;
+	return;
+      }
+  }
+#else /* WINDOWS */
+  if (pthread_create (&cas_log_flusher_thread, NULL, cas_log_flusher_thr_f, NULL) != 0)
+    {
+      cas_log_flusher_running = false;
+      return;
+    }
+#endif /* WINDOWS */
+  cas_log_flusher_started = true;
+}
+
+/*
+ * cas_log_stop_flusher () - stop the flusher thread and wait until it is gone
+ *   return: void
+ *
+ * note: the streams are flushed synchronously afterwards.
+ */
+static void
+cas_log_stop_flusher (void)
+{
+  if (!cas_log_flusher_started)
+    {
+      return;
+    }
+
+  pthread_mutex_lock (&cas_log_flush_mutex);
+  cas_log_flusher_exit = true;
+  pthread_cond_broadcast (&cas_log_flush_cond);
+#if defined(WINDOWS)
+  while (cas_log_flusher_running)
+    {
+      pthread_cond_wait (&cas_log_flush_cond, &cas_log_flush_mutex);
+    }
+#endif /* WINDOWS */
+  pthread_mutex_unlock (&cas_log_flush_mutex);
+
+#if !defined(WINDOWS)
+  pthread_join (cas_log_flusher_thread, NULL);
+#endif /* !WINDOWS */
+
+  cas_log_flusher_started = false;
+
+  /* what the thread did not flush yet */
+  if (log_fp != NULL && log_fp_dirty)
+    {
+      log_fp_dirty = false;
+      cas_fflush (log_fp);
+    }
+  if (slow_log_fp != NULL && slow_log_fp_dirty)
+    {
+      slow_log_fp_dirty = false;
+      cas_fflush (slow_log_fp);
+    }
+}
+#endif /* !LIBCAS_FOR_JSP */
+
+/*
+ * cas_log_request_flush () - flush a log stream, deferring it to the flusher thread when possible
+ *   return: void
+ *   fp(in): sql log or slow log stream
+ */
+static void
+cas_log_request_flush (FILE * fp)
+{
+  if (!cas_log_flusher_started)
+    {
+      cas_fflush (fp);
+      return;
+    }
+
+  if (fp != log_fp && fp != slow_log_fp)
+    {
+      cas_fflush (fp);
+      return;
+    }
+
+  pthread_mutex_lock (&cas_log_flush_mutex);
+  if (fp == log_fp)
+    {
+      log_fp_dirty = true;
+    }
+  else
+    {
+      slow_log_fp_dirty = true;
+    }
+  pthread_mutex_unlock (&cas_log_flush_mutex);
+}
+
+#ifndef LIBCAS_FOR_JSP
+static THREAD_FUNC
+cas_log_flusher_thr_f (void *arg)
+{
+  struct timeval now;
+  struct timespec wakeup_time;
+
+  pthread_mutex_lock (&cas_log_flush_mutex);
+  while (!cas_log_flusher_exit)
+    {
+      gettimeofday (&now, NULL);
+      wakeup_time.tv_sec = now.tv_sec + (now.tv_usec / 1000 + CAS_LOG_FLUSH_INTERVAL_MSEC) / 1000;
+      wakeup_time.tv_nsec = ((now.tv_usec / 1000 + CAS_LOG_FLUSH_INTERVAL_MSEC) % 1000) * 1000000;
+      (void) pthread_cond_timedwait (&cas_log_flush_cond, &cas_log_flush_mutex, &wakeup_time);
+      if (cas_log_flusher_exit)
+	{
+	  break;
+	}
+
+      if (log_fp != NULL && log_fp_dirty)
+	{
+	  log_fp_dirty = false;
+	  fflush (log_fp);
+	}
+      if (slow_log_fp != NULL && slow_log_fp_dirty)
+	{
+	  slow_log_fp_dirty = false;
+	  fflush (slow_log_fp);
+	}
+    }
+  cas_log_flusher_running = false;
+  pthread_cond_broadcast (&cas_log_flush_cond);
+  pthread_mutex_unlock (&cas_log_flush_mutex);
+
+#if !defined(WINDOWS)
+  return NULL;
+#endif /* !WINDOWS */
+}
+#endif /* !LIBCAS_FOR_JSP */
+
 static void
 cas_log_write_and_set_savedpos (FILE * log_fp, const char *fmt, ...)
 {
@@ -435,7 +643,7 @@ cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_nu
 
   if (do_flush == true)
     {
-      cas_fflush (fp);
+      cas_log_request_flush (fp);
     }
 }
 
@@ -577,7 +785,7 @@ cas_log_write2_internal (FILE * fp, bool do_flush, const char *fmt, va_list ap)
 
   if (do_flush == true)
     {
-      cas_fflush (fp);
+      cas_log_request_flush (fp);
     }
 }
 
@@ -986,6 +1194,10 @@ cas_slow_log_open (char *br_name)
 
       /* note: in "a+" mode, output is always appended */
       slow_log_fp = cas_fopen (slow_log_filepath, "a+");
+      if (slow_log_fp != NULL)
+	{
+	  cas_log_start_flusher ();
+	}
     }
   else
     {
@@ -1024,8 +1236,17 @@ cas_slow_log_close ()
 #ifndef LIBCAS_FOR_JSP
   if (slow_log_fp != NULL)
     {
+      if (cas_log_flusher_started)
+	{
+	  pthread_mutex_lock (&cas_log_flush_mutex);
+	}
       cas_fclose (slow_log_fp);
       slow_log_fp = NULL;
+      slow_log_fp_dirty = false;
+      if (cas_log_flusher_started)
+	{
+	  pthread_mutex_unlock (&cas_log_flush_mutex);
+	}
     }
 #endif /* LIBCAS_FOR_JSP */
 }
@@ -1053,7 +1274,7 @@ cas_slow_log_end ()
       else
 	{
 	  cas_fputc ('\n', slow_log_fp);
-	  cas_fflush (slow_log_fp);
+	  cas_log_request_flush (slow_log_fp);
 	}
     }
 #endif /* LIBCAS_FOR_JSP */
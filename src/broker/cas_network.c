@@ -281,6 +281,48 @@ net_connect_client (SOCKET srv_sock_fd)
   return clt_sock_fd;
 }
 
+/*
+ * net_wait_client () - wait for the broker to hand over a client
+ *   return: 1 if a connection is pending, 0 on timeout, -1 on error
+ *   srv_sock_fd(in): listening socket of this CAS
+ *   timeout_sec(in): wait time in seconds
+ */
+int
+net_wait_client (SOCKET srv_sock_fd, int timeout_sec)
+{
+  int n;
+#if defined(WINDOWS)
+  fd_set read_mask;
+  struct timeval timeout;
+
+  FD_ZERO (&read_mask);
+  FD_SET (srv_sock_fd, &read_mask);
+  timeout.tv_sec = timeout_sec;
+  timeout.tv_usec = 0;
+
+  n = select ((int) srv_sock_fd + 1, &read_mask, NULL, NULL, &timeout);
+#else /* WINDOWS */
+  struct pollfd po[1] = { {0, 0, 0} };
+
+  po[0].fd = srv_sock_fd;
+  po[0].events = POLLIN;
+
+retry_poll:
+  n = poll (po, 1, timeout_sec * 1000);
+  if (n < 0 && errno == EINTR)
+    {
+      goto retry_poll;
+    }
+#endif /* WINDOWS */
+
+  if (n < 0)
+    {
+      return -1;
+    }
+
+  return (n > 0) ? 1 : 0;
+}
+
 int
 net_write_stream (SOCKET sock_fd, const char *buf, int size)
 {
@@ -115,6 +115,10 @@ int wsa_initialize ();
 #define IS_OUT_TRAN(c) ((c)->con_status == CCI_CON_STATUS_OUT_TRAN)
 #define IS_IN_TRAN(c) ((c)->con_status == CCI_CON_STATUS_IN_TRAN)
 #define IS_FORCE_FAILBACK(c) ((c)->force_failback == 1)
+/* requests can be pipelined only while the cas is bound to the client until the replies are read */
+#define CAN_PIPELINE_REQUESTS(c) \
+  ((c)->autocommit_mode == CCI_AUTOCOMMIT_FALSE && IS_IN_TRAN (c) && !qe_is_shard (c) \
+   && (c)->broker_info[BROKER_INFO_KEEP_CONNECTION] == CAS_KEEP_CONNECTION_ON)
 #define IS_ER_COMMUNICATION(e) \
   ((e) == CCI_ER_COMMUNICATION || (e) == CAS_ER_COMMUNICATION)
 #define IS_SERVER_DOWN(e) \
@@ -186,6 +190,7 @@ static void copy_error_buffer (T_CCI_ERROR * dest_err_buf_p, T_CCI_ERROR * src_e
 static int cci_datasource_release_internal (T_CCI_DATASOURCE * ds, T_CON_HANDLE * con_handle);
 static int cci_end_tran_internal (T_CON_HANDLE * con_handle, char type);
 static void get_last_error (T_CON_HANDLE * con_handle, T_CCI_ERROR * dest_err_buf);
+static void log_slow_query (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, long elapsed);
 
 static int convert_cas_mode_to_driver_mode (int cas_mode);
 static int convert_driver_mode_to_cas_mode (int driver_mode);
@@ -1414,18 +1419,8 @@ execute_end:
   API_ELOG (con_handle, error);
   if (con_handle->log_slow_queries)
     {
-      long elapsed;
-
       gettimeofday (&et, NULL);
-      elapsed = ELAPSED_MSECS (et, st);
-      if (elapsed > con_handle->slow_query_threshold_millis)
-	{
-	  CCI_LOGF_DEBUG (con_handle->logger,
-			  "[CONHANDLE - %04d] " "[CAS INFO - %d.%d.%d.%d:%d, %d, %d] "
-			  "[SLOW QUERY - ELAPSED : %d] [SQL - %s]", con_handle->id, con_handle->ip_addr[0],
-			  con_handle->ip_addr[1], con_handle->ip_addr[2], con_handle->ip_addr[3], con_handle->port,
-			  con_handle->cas_id, con_handle->cas_pid, elapsed, req_handle->sql_text);
-	}
+      log_slow_query (con_handle, req_handle, ELAPSED_MSECS (et, st));
     }
 
   set_error_buffer (&(con_handle->err_buf), error, NULL);
@@ -1435,6 +1430,23 @@ execute_end:
   return error;
 }
 
+/*
+ * log_slow_query () - log a statement that ran longer than slowQueryThresholdMillis
+ *   elapsed(in): execution time of the statement in milliseconds
+ */
+static void
+log_slow_query (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, long elapsed)
+{
+  if (elapsed > con_handle->slow_query_threshold_millis)
+    {
+      CCI_LOGF_DEBUG (con_handle->logger,
+		      "[CONHANDLE - %04d] " "[CAS INFO - %d.%d.%d.%d:%d, %d, %d] "
+		      "[SLOW QUERY - ELAPSED : %ld] [SQL - %s]", con_handle->id, con_handle->ip_addr[0],
+		      con_handle->ip_addr[1], con_handle->ip_addr[2], con_handle->ip_addr[3], con_handle->port,
+		      con_handle->cas_id, con_handle->cas_pid, elapsed, req_handle->sql_text);
+    }
+}
+
 /*
  * For the purpose of re-balancing existing connections, cci_prepare,
  * cci_execute, cci_execute_array, cci_prepare_and_execute,
@@ -1534,18 +1546,8 @@ cci_prepare_and_execute (int mapped_conn_id, char *sql_stmt, int max_col_size, i
 
   if (con_handle->log_slow_queries)
     {
-      long elapsed;
-
       gettimeofday (&et, NULL);
-      elapsed = ELAPSED_MSECS (et, st);
-      if (elapsed > con_handle->slow_query_threshold_millis)
-	{
-	  CCI_LOGF_DEBUG (con_handle->logger,
-			  "[CONHANDLE - %04d] " "[CAS INFO - %d.%d.%d.%d:%d, %d, %d] "
-			  "[SLOW QUERY - ELAPSED : %d] [SQL - %s]", con_handle->id, con_handle->ip_addr[0],
-			  con_handle->ip_addr[1], con_handle->ip_addr[2], con_handle->ip_addr[3], con_handle->port,
-			  con_handle->cas_id, con_handle->cas_pid, elapsed, req_handle->sql_text);
-	}
+      log_slow_query (con_handle, req_handle, ELAPSED_MSECS (et, st));
     }
 
   RESET_START_TIME (con_handle);
@@ -3256,6 +3258,233 @@ ret:
   return error;
 }
 
+/*
+ * cci_execute_pipeline () - execute prepared statements of one connection, sending the requests back to back
+ *   return: error code of the first failed statement, or CCI_ER_NO_ERROR
+ *   mapped_stmt_ids(in): statements to execute, in order; all of them must belong to the same connection
+ *   num_stmt(in): number of statements
+ *   flag(in): execute flag, as for cci_execute
+ *   max_col_size(in): as for cci_execute
+ *   results(out): result of cci_execute for each statement
+ *   err_buf(out): error of the first failed statement
+ *
+ * note: the requests are pipelined while the connection is in a transaction with autocommit off. Otherwise, e.g.
+ *       for the statement starting the transaction, they are executed one by one as cci_execute does.
+ *       A failed statement does not stop the others, unless the server aborted the transaction (e.g. deadlock). The
+ *       statements after it then get CCI_ER_NOT_EXECUTED; those already sent are rolled back, which frees the
+ *       request handles of the connection like cci_end_tran does.
+ */
+int
+cci_execute_pipeline (int *mapped_stmt_ids, int num_stmt, char flag, int max_col_size, int *results,
+		      T_CCI_ERROR * err_buf)
+{
+  T_CON_HANDLE *con_handle = NULL;
+  T_CON_HANDLE *stmt_con_handle = NULL;
+  T_REQ_HANDLE **req_handles = NULL;
+  T_CCI_ERROR stmt_err_buf;
+  int *elapsed_msecs = NULL;
+  struct timeval st, et;
+  int error = CCI_ER_NO_ERROR;
+  int i, j;
+
+  reset_error_buffer (err_buf);
+  if (mapped_stmt_ids == NULL || results == NULL || num_stmt <= 0)
+    {
+      set_error_buffer (err_buf, CCI_ER_INVALID_ARGS, NULL);
+      return CCI_ER_INVALID_ARGS;
+    }
+
+  req_handles = (T_REQ_HANDLE **) MALLOC (sizeof (T_REQ_HANDLE *) * num_stmt);
+  if (req_handles == NULL)
+    {
+      set_error_buffer (err_buf, CCI_ER_NO_MORE_MEMORY, NULL);
+      return CCI_ER_NO_MORE_MEMORY;
+    }
+
+  for (i = 0; i < num_stmt; i++)
+    {
+      error = hm_get_statement (mapped_stmt_ids[i], &stmt_con_handle, &req_handles[i]);
+      if (error == CCI_ER_NO_ERROR && con_handle != NULL && stmt_con_handle != con_handle)
+	{
+	  error = CCI_ER_INVALID_ARGS;
+	}
+      if (error != CCI_ER_NO_ERROR)
+	{
+	  FREE_MEM (req_handles);
+	  set_error_buffer (err_buf, error, NULL);
+	  return error;
+	}
+      con_handle = stmt_con_handle;
+    }
+
+  /* execute one by one until the statements can be pipelined */
+  for (i = 0; i < num_stmt && !CAN_PIPELINE_REQUESTS (con_handle); i++)
+    {
+      results[i] = cci_execute (mapped_stmt_ids[i], flag, max_col_size, &stmt_err_buf);
+      if (results[i] < 0 && error == CCI_ER_NO_ERROR)
+	{
+	  error = results[i];
+	  if (err_buf != NULL)
+	    {
+	      *err_buf = stmt_err_buf;
+	    }
+	}
+      if (results[i] < 0 && qe_is_tran_aborted_error (results[i], &stmt_err_buf))
+	{
+	  /* the next statements would run in a new transaction */
+	  for (i++; i < num_stmt; i++)
+	    {
+	      results[i] = CCI_ER_NOT_EXECUTED;
+	    }
+	  break;
+	}
+    }
+
+  if (i == num_stmt)
+    {
+      FREE_MEM (req_handles);
+      return error;
+    }
+
+  reset_error_buffer (&(con_handle->err_buf));
+  con_handle->shard_id = CCI_SHARD_ID_INVALID;
+
+  API_SLOG (con_handle);
+  if (con_handle->log_trace_api)
+    {
+      CCI_LOGF_DEBUG (con_handle->logger, "NUM_STMT[%d], FLAG[%d], MAX_COL_SIZE[%d]", num_stmt - i, flag,
+		      max_col_size);
+    }
+
+  if (flag & CCI_EXEC_ONLY_QUERY_PLAN)
+    {
+      flag |= CCI_EXEC_QUERY_INFO;
+    }
+
+  /* Asynchronous mode is unsupported. */
+  flag &= ~CCI_EXEC_ASYNC;
+
+  SET_START_TIME_FOR_QUERY (con_handle, NULL);
+
+  if (con_handle->log_slow_queries)
+    {
+      /* without it the statements are executed but not logged */
+      elapsed_msecs = (int *) MALLOC (sizeof (int) * num_stmt);
+      if (elapsed_msecs != NULL)
+	{
+	  memset (elapsed_msecs, 0, sizeof (int) * num_stmt);
+	}
+    }
+
+  for (j = i; j < num_stmt; j++)
+    {
+      req_handles[j]->shard_id = CCI_SHARD_ID_INVALID;
+      if (IS_BROKER_STMT_POOL (con_handle) && req_handles[j]->valid == false)
+	{
+	  int prepare_error;
+
+	  prepare_error =
+	    qe_prepare (req_handles[j], con_handle, req_handles[j]->sql_text, req_handles[j]->prepare_flag,
+			&(con_handle->err_buf), 1);
+	  if (prepare_error < 0)
+	    {
+	      /* nothing has been sent yet */
+	      for (j = i; j < num_stmt; j++)
+		{
+		  results[j] = prepare_error;
+		}
+	      if (error == CCI_ER_NO_ERROR)
+		{
+		  error = prepare_error;
+		}
+	      goto pipeline_end;
+	    }
+	}
+    }
+
+  j = qe_execute_pipeline (con_handle, req_handles + i, num_stmt - i, flag, max_col_size, results + i,
+			   (elapsed_msecs != NULL) ? elapsed_msecs + i : NULL, &(con_handle->err_buf));
+  if (error == CCI_ER_NO_ERROR)
+    {
+      error = j;
+    }
+
+  /* plans invalidated while their statements were pooled are prepared and executed again one by one */
+  for (j = i; j < num_stmt && IS_BROKER_STMT_POOL (con_handle); j++)
+    {
+      if (results[j] != CAS_ER_STMT_POOLING)
+	{
+	  continue;
+	}
+
+      if (elapsed_msecs != NULL)
+	{
+	  gettimeofday (&st, NULL);
+	}
+      req_handle_content_free (req_handles[j], 1);
+      results[j] =
+	qe_prepare (req_handles[j], con_handle, req_handles[j]->sql_text, req_handles[j]->prepare_flag,
+		    &(con_handle->err_buf), 1);
+      if (results[j] >= 0)
+	{
+	  results[j] = qe_execute (req_handles[j], con_handle, flag, max_col_size, &(con_handle->err_buf));
+	}
+      if (elapsed_msecs != NULL)
+	{
+	  gettimeofday (&et, NULL);
+	  elapsed_msecs[j] = ELAPSED_MSECS (et, st);
+	}
+    }
+
+  /* the statements executed one by one above were logged by cci_execute */
+  for (j = i; j < num_stmt && elapsed_msecs != NULL; j++)
+    {
+      log_slow_query (con_handle, req_handles[j], elapsed_msecs[j]);
+    }
+
+  if (error == CAS_ER_STMT_POOLING)
+    {
+      /* recompute the first error once the retried statements are done */
+      reset_error_buffer (&(con_handle->err_buf));
+      error = CCI_ER_NO_ERROR;
+      for (j = 0; j < num_stmt; j++)
+	{
+	  if (results[j] < 0)
+	    {
+	      error = results[j];
+	      break;
+	    }
+	}
+    }
+
+pipeline_end:
+  RESET_START_TIME (con_handle);
+
+  if (error == CCI_ER_QUERY_TIMEOUT && con_handle->disconnect_on_query_timeout)
+    {
+      hm_force_close_connection (con_handle);
+    }
+
+  if (IS_OUT_TRAN (con_handle))
+    {
+      hm_check_rc_time (con_handle);
+    }
+
+  API_ELOG (con_handle, error);
+
+  set_error_buffer (&(con_handle->err_buf), error, NULL);
+  if (err_buf == NULL || err_buf->err_code == CCI_ER_NO_ERROR)
+    {
+      get_last_error (con_handle, err_buf);
+    }
+  con_handle->used = false;
+
+  FREE_MEM (req_handles);
+  FREE_MEM (elapsed_msecs);
+
+  return error;
+}
+
 int
 cci_fetch_buffer_clear (int mapped_stmt_id)
 {
@@ -4584,6 +4813,9 @@ cci_get_err_msg_internal (int error)
     case CCI_ER_SSL_HANDSHAKE:
       return "SSL handshake failure";
 
+    case CCI_ER_NOT_EXECUTED:
+      return "Not executed because a previous statement aborted the transaction";
+
     case CAS_ER_INTERNAL:
       return "Not used";
 
@@ -494,6 +494,8 @@ typedef enum
   CCI_ER_NO_SHARD_AVAILABLE = -20045,
   CCI_ER_INVALID_SHARD = -20046,
 
+  CCI_ER_NOT_EXECUTED = -20047,
+
   CCI_ER_SSL_HANDSHAKE = -21047,
 
   CCI_ER_NOT_IMPLEMENTED = -20099,
@@ -864,6 +866,8 @@ extern "C"
 				T_CCI_A_TYPE a_type, void *value, T_CCI_ERROR * err_buf);
   extern int cci_execute_batch (int con_h_id, int num_query, char **sql_stmt,
 				T_CCI_QUERY_RESULT ** qr, T_CCI_ERROR * err_buf);
+  extern int cci_execute_pipeline (int *req_h_ids, int num_stmt, char flag, int max_col_size, int *results,
+				   T_CCI_ERROR * err_buf);
   extern int cci_fetch_buffer_clear (int req_h_id);
   extern int cci_execute_result (int req_h_id, T_CCI_QUERY_RESULT ** qr, T_CCI_ERROR * err_buf);
   extern int cci_set_isolation_level (int con_id, T_CCI_TRAN_ISOLATION val, T_CCI_ERROR * err_buf);
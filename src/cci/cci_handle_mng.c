@@ -1324,6 +1324,8 @@ init_con_handle (T_CON_HANDLE * con_handle, char *ip_str, int port, char *db_nam
   con_handle->ssl_handle.ssl = NULL;
   con_handle->ssl_handle.ctx = NULL;
   con_handle->useSSL = false;
+  con_handle->pool_prepared_statement = false;
+  con_handle->max_open_prepared_statement = MAX_OPEN_PREPARED_STATEMENT_DEFAULT;
   con_handle->deferred_max_close_handle_count = DEFERRED_CLOSE_HANDLE_ALLOC_SIZE;
   con_handle->deferred_close_handle_list = (int *) MALLOC (sizeof (int) * con_handle->deferred_max_close_handle_count);
   con_handle->deferred_close_handle_count = 0;
@@ -75,11 +75,17 @@
 #define ALTER_HOST_MAX_SIZE                     256
 #define DEFERRED_CLOSE_HANDLE_ALLOC_SIZE        256
 #define MONITORING_INTERVAL		    	60
+#define MAX_OPEN_PREPARED_STATEMENT_DEFAULT	1000
 
+/* a connection taken from a datasource follows the datasource settings. a standalone connection pools statements
+ * only when the broker keeps them prepared across transactions (STATEMENT_POOLING=ON) */
 #define DOES_CONNECTION_HAVE_STMT_POOL(c) \
-  ((c)->datasource && (c)->datasource->pool_prepared_statement)
+  ((c)->datasource ? (c)->datasource->pool_prepared_statement \
+   : ((c)->pool_prepared_statement \
+      && (c)->broker_info[BROKER_INFO_STATEMENT_POOLING] == CAS_STATEMENT_POOLING_ON))
 #define HAS_REACHED_LIMIT_OPEN_STATEMENT(c) \
-  ((c)->open_prepared_statement_count >= (c)->datasource->max_open_prepared_statement)
+  ((c)->open_prepared_statement_count >= \
+   ((c)->datasource ? (c)->datasource->max_open_prepared_statement : (c)->max_open_prepared_statement))
 
 #define REACHABLE       true
 #define UNREACHABLE     false
@@ -258,6 +264,8 @@ typedef struct
   char log_trace_api;
   char log_trace_network;
   char useSSL;
+  char pool_prepared_statement;
+  int max_open_prepared_statement;
 
   /* to check timeout */
   struct timeval start_time;	/* function start time to check timeout */
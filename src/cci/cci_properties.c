@@ -357,6 +357,8 @@ cci_conn_set_properties (T_CON_HANDLE * handle, char *properties)
     {"disconnect_on_query_timeout", BOOL_PROPERTY,
      &handle->disconnect_on_query_timeout},
     {"useSSL", BOOL_PROPERTY, &handle->useSSL},
+    {"poolPreparedStatement", BOOL_PROPERTY, &handle->pool_prepared_statement},
+    {"maxOpenPreparedStatement", INT_PROPERTY, &handle->max_open_prepared_statement},
   };
   int error = CCI_ER_NO_ERROR;
 
@@ -367,7 +369,7 @@ cci_conn_set_properties (T_CON_HANDLE * handle, char *properties)
     }
 
   if (handle->rc_time < 0 || handle->slow_query_threshold_millis < 0 || handle->login_timeout < 0
-      || handle->query_timeout < 0)
+      || handle->query_timeout < 0 || handle->max_open_prepared_statement < 1)
     {
       error = CCI_ER_INVALID_URL;
       goto set_properties_end;
@@ -54,6 +54,7 @@
 #include <unistd.h>
 #include <arpa/inet.h>
 #include <sys/socket.h>
+#include <sys/time.h>
 #endif
 
 /************************************************************************
@@ -70,6 +71,7 @@
 #include "cci_t_set.h"
 #include "cci_t_lob.h"
 #include "cci_map.h"
+#include "error_code.h"
 
 /************************************************************************
  * PRIVATE DEFINITIONS							*
@@ -158,6 +160,10 @@
 #define EXECUTE_BATCH	1
 #define EXECUTE_EXEC	2
 
+/* bytes of execute requests sent by qe_execute_pipeline before the reply of the oldest one is read. it is kept below
+ * the usual socket buffer size, so that sending never blocks while the cas is blocked sending a reply. */
+#define PIPELINE_MAX_PENDING_BYTES	(32 * 1024)
+
 /************************************************************************
  * PRIVATE TYPE DEFINITIONS						*
  ************************************************************************/
@@ -173,6 +179,10 @@ typedef enum
  * PRIVATE FUNCTION PROTOTYPES						*
  ************************************************************************/
 
+static int qe_execute_send (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size,
+			    int *recv_timeout, int *request_size);
+static int qe_execute_recv (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int recv_timeout,
+			    T_CCI_ERROR * err_buf);
 static int prepare_info_decode (char *buf, int *size, T_REQ_HANDLE * req_handle);
 static int out_rs_info_decode (char *buf, int *size, T_REQ_HANDLE * req_handle);
 static int get_cursor_pos (T_REQ_HANDLE * req_handle, int offset, char origin);
@@ -564,25 +574,25 @@ qe_bind_param (T_REQ_HANDLE * req_handle, int index, T_CCI_A_TYPE a_type, void *
   return err_code;
 }
 
-int
-qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size, T_CCI_ERROR * err_buf)
+/*
+ * qe_execute_send () - build and send an execute request without waiting for the reply
+ *   return: error code
+ *   recv_timeout(out): timeout to pass to qe_execute_recv
+ *   request_size(out): bytes sent, can be NULL
+ */
+static int
+qe_execute_send (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size, int *recv_timeout,
+		 int *request_size)
 {
   T_NET_BUF net_buf;
   char func_code = CAS_FC_EXECUTE;
   char autocommit_flag;
   int i;
   int err_code = 0;
-  int res_count;
-  char *result_msg = NULL, *msg;
-  int result_msg_size;
-  T_CCI_QUERY_RESULT *qr = NULL;
   char fetch_flag;
   char forward_only_cursor;
-  char include_column_info;
-  int remain_msg_size = 0;
   int remaining_time = 0;
   bool use_server_query_cancel = false;
-  int shard_id;
   T_BROKER_VERSION broker_ver;
 
   req_handle->is_fetch_completed = 0;
@@ -676,11 +686,41 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
       goto execute_error;
     }
 
+  if (request_size != NULL)
+    {
+      *request_size = net_buf.data_size;
+    }
+
   net_buf_clear (&net_buf);
 
-  res_count =
-    net_recv_msg_timeout (con_handle, &result_msg, &result_msg_size, err_buf,
-			  ((use_server_query_cancel) ? 0 : remaining_time));
+  *recv_timeout = (use_server_query_cancel) ? 0 : remaining_time;
+
+  return CCI_ER_NO_ERROR;
+
+execute_error:
+  net_buf_clear (&net_buf);
+  return err_code;
+}
+
+/*
+ * qe_execute_recv () - receive and decode the reply of a request sent by qe_execute_send
+ *   return: result count or error code
+ */
+static int
+qe_execute_recv (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int recv_timeout,
+		 T_CCI_ERROR * err_buf)
+{
+  int err_code = 0;
+  int res_count;
+  char *result_msg = NULL, *msg;
+  int result_msg_size;
+  T_CCI_QUERY_RESULT *qr = NULL;
+  char include_column_info;
+  int remain_msg_size = 0;
+  int shard_id;
+  T_BROKER_VERSION broker_ver;
+
+  res_count = net_recv_msg_timeout (con_handle, &result_msg, &result_msg_size, err_buf, recv_timeout);
 
   if (res_count < 0)
     {
@@ -729,6 +769,7 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
   hm_req_handle_fetch_buf_free (req_handle);
   req_handle->cursor_pos = 0;
 
+  broker_ver = hm_get_broker_version (con_handle);
   if (hm_broker_understand_the_protocol (broker_ver, PROTOCOL_V2))
     {
       msg = result_msg + (result_msg_size - remain_msg_size);
@@ -786,10 +827,178 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
   req_handle->is_from_current_transaction = 1;
 
   return res_count;
+}
 
-execute_error:
-  net_buf_clear (&net_buf);
-  return err_code;
+int
+qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size, T_CCI_ERROR * err_buf)
+{
+  int err_code;
+  int recv_timeout = 0;
+
+  err_code = qe_execute_send (req_handle, con_handle, flag, max_col_size, &recv_timeout, NULL);
+  if (err_code < 0)
+    {
+      return err_code;
+    }
+
+  return qe_execute_recv (req_handle, con_handle, flag, recv_timeout, err_buf);
+}
+
+/*
+ * qe_execute_pipeline () - execute several prepared statements of one connection with a single round trip
+ *   return: error code of the first failed statement, or CCI_ER_NO_ERROR
+ *   req_handles(in): statements to execute, in order
+ *   num_stmt(in): number of statements
+ *   results(out): result count or error code of each statement
+ *   elapsed_msecs(out): execution time of each statement, can be NULL
+ *
+ * note: all requests are written to the socket before any reply is read. cas handles them one by one in the order
+ *       they were sent, so the replies come back in the same order.
+ *       the execution of a statement is timed from when its request was sent or the previous reply was read,
+ *       whichever comes later, until its reply is read.
+ */
+int
+qe_execute_pipeline (T_CON_HANDLE * con_handle, T_REQ_HANDLE ** req_handles, int num_stmt, char flag,
+		     int max_col_size, int *results, int *elapsed_msecs, T_CCI_ERROR * err_buf)
+{
+  int i, sent = 0;
+  int *recv_timeouts, *request_sizes;
+  struct timeval *send_times = NULL;
+  struct timeval last_reply_time;
+  int pending_bytes = 0;
+  int first_error = CCI_ER_NO_ERROR;
+  int aborted_index = -1;
+  bool is_con_lost = false;
+  bool executed_after_abort = false;
+  T_CCI_ERROR later_err_buf;
+  T_CCI_ERROR *stmt_err_buf;
+
+  recv_timeouts = (int *) MALLOC (sizeof (int) * num_stmt * 2);
+  if (recv_timeouts == NULL)
+    {
+      return CCI_ER_NO_MORE_MEMORY;
+    }
+  request_sizes = recv_timeouts + num_stmt;
+
+  if (elapsed_msecs != NULL)
+    {
+      send_times = (struct timeval *) MALLOC (sizeof (struct timeval) * num_stmt);
+      if (send_times == NULL)
+	{
+	  FREE_MEM (recv_timeouts);
+	  return CCI_ER_NO_MORE_MEMORY;
+	}
+      memset (elapsed_msecs, 0, sizeof (int) * num_stmt);
+      gettimeofday (&last_reply_time, NULL);
+    }
+
+  for (i = 0; i < num_stmt; i++)
+    {
+      /* the cas reads the next request only after it has written the reply of the previous one; bound the bytes
+       * in flight so that both sides never block writing to each other at the same time. a request larger than the
+       * bound is sent alone. */
+      while (sent < num_stmt && pending_bytes < PIPELINE_MAX_PENDING_BYTES && aborted_index < 0 && !is_con_lost)
+	{
+	  request_sizes[sent] = 0;
+	  results[sent] =
+	    qe_execute_send (req_handles[sent], con_handle, flag, max_col_size, &recv_timeouts[sent],
+			     &request_sizes[sent]);
+	  if (results[sent] < 0 && IS_INVALID_SOCKET (con_handle->sock_fd))
+	    {
+	      /* the connection is lost; nothing more can be sent */
+	      is_con_lost = true;
+	    }
+	  if (send_times != NULL)
+	    {
+	      gettimeofday (&send_times[sent], NULL);
+	    }
+	  pending_bytes += request_sizes[sent];
+	  sent++;
+	}
+
+      if (i >= sent)
+	{
+	  results[i] = (aborted_index >= 0) ? CCI_ER_NOT_EXECUTED : CCI_ER_COMMUNICATION;
+	  continue;
+	}
+
+      /* once its reply is read, the request no longer takes space in the socket buffers */
+      pending_bytes -= request_sizes[i];
+
+      if (results[i] < 0)
+	{
+	  /* not sent; there is no reply to read */
+	  if (first_error == CCI_ER_NO_ERROR)
+	    {
+	      first_error = results[i];
+	    }
+	  continue;
+	}
+
+      /* err_buf keeps the error of the first failed statement */
+      stmt_err_buf = (first_error == CCI_ER_NO_ERROR) ? err_buf : &later_err_buf;
+      results[i] = qe_execute_recv (req_handles[i], con_handle, flag, recv_timeouts[i], stmt_err_buf);
+      if (send_times != NULL)
+	{
+	  elapsed_msecs[i] = MIN (get_elapsed_time (&send_times[i]), get_elapsed_time (&last_reply_time));
+	  gettimeofday (&last_reply_time, NULL);
+	}
+      if (results[i] >= 0)
+	{
+	  executed_after_abort = executed_after_abort || aborted_index >= 0;
+	  continue;
+	}
+
+      if (first_error == CCI_ER_NO_ERROR)
+	{
+	  first_error = results[i];
+	}
+      if (IS_INVALID_SOCKET (con_handle->sock_fd))
+	{
+	  is_con_lost = true;
+	}
+      else if (aborted_index < 0 && qe_is_tran_aborted_error (results[i], stmt_err_buf))
+	{
+	  aborted_index = i;
+	}
+    }
+
+  FREE_MEM (recv_timeouts);
+  FREE_MEM (send_times);
+
+  if (aborted_index >= 0)
+    {
+      if (executed_after_abort && !is_con_lost)
+	{
+	  /* statements already in flight were executed by a new transaction; undo them */
+	  (void) qe_end_tran (con_handle, CCI_TRAN_ROLLBACK, &later_err_buf);
+	}
+
+      for (i = aborted_index + 1; i < sent; i++)
+	{
+	  results[i] = CCI_ER_NOT_EXECUTED;
+	}
+    }
+
+  return first_error;
+}
+
+/*
+ * qe_is_tran_aborted_error () - check whether the error of a statement means that the server aborted its transaction
+ *   return: true if the transaction was aborted
+ *   error(in): error code returned for the statement
+ *   err_buf(in): error of the statement
+ */
+bool
+qe_is_tran_aborted_error (int error, const T_CCI_ERROR * err_buf)
+{
+  if (error != CCI_ER_DBMS && error != CAS_ER_DBMS)
+    {
+      return false;
+    }
+
+  return (err_buf->err_code == ER_LK_UNILATERALLY_ABORTED
+	  || err_buf->err_code == ER_TM_SERVER_DOWN_UNILATERALLY_ABORTED);
 }
 
 int
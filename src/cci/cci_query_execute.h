@@ -398,6 +398,9 @@ extern int qe_bind_param (T_REQ_HANDLE * req_handle, int index, T_CCI_A_TYPE a_t
 			  T_CCI_U_TYPE u_type, char flag);
 extern int qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size,
 		       T_CCI_ERROR * err_buf);
+extern int qe_execute_pipeline (T_CON_HANDLE * con_handle, T_REQ_HANDLE ** req_handles, int num_stmt, char flag,
+				int max_col_size, int *results, int *elapsed_msecs, T_CCI_ERROR * err_buf);
+extern bool qe_is_tran_aborted_error (int error, const T_CCI_ERROR * err_buf);
 extern int qe_end_tran (T_CON_HANDLE * con_handle, char type, T_CCI_ERROR * err_buf);
 extern int qe_end_session (T_CON_HANDLE * con_handle, T_CCI_ERROR * err_buf);
 extern int qe_get_db_parameter (T_CON_HANDLE * con_handle, T_CCI_DB_PARAM param_name, void *value,
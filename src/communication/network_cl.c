@@ -646,6 +646,8 @@ net_histo_setup_names (void)
   net_Req_buffer[NET_SERVER_LD_DESTROY].name = "NET_SERVER_LD_DESTROY";
   net_Req_buffer[NET_SERVER_LD_INTERRUPT].name = "NET_SERVER_LD_INTERRUPT";
   net_Req_buffer[NET_SERVER_LD_UPDATE_STATS].name = "NET_SERVER_LD_UPDATE_STATS";
+
+  net_Req_buffer[NET_SERVER_QM_QUERY_EXECUTE_ARRAY].name = "NET_SERVER_QM_QUERY_EXECUTE_ARRAY";
 }
 
 /*
@@ -67,6 +67,7 @@
 #include "dbtype.h"
 #include "compile_context.h"
 #if defined (SA_MODE)
+#include "cursor.h"
 #include "thread_manager.hpp"
 #endif // SA_MODE
 #include "xasl.h"
@@ -6575,6 +6576,132 @@ cleanup:
 #endif /* !CS_MODE */
 }
 
+/*
+ * qmgr_execute_query_array - execute a prepared query once for each row of parameter values
+ *
+ * return: number of rows executed successfully
+ *
+ *   xasl_id(in):
+ *   dbval_cnt(in): number of parameter values of a row
+ *   row_cnt(in): number of rows
+ *   dbvals(in): parameter values of the rows, row after row
+ *   flag(in):
+ *   query_timeout(in):
+ *   row_counts(out): tuple count of each executed row
+ *
+ * NOTE: All the rows are sent to the server in one request. The execution stops at the first row that fails, and
+ * its error is set. The queries are ended on the server, so there is nothing to fetch nor to end for the caller.
+ * This function is a counter part to sqmgr_execute_query_array().
+ */
+int
+qmgr_execute_query_array (const XASL_ID * xasl_id, int dbval_cnt, int row_cnt, const DB_VALUE * dbvals,
+			  QUERY_FLAG flag, int query_timeout, int *row_counts)
+{
+#if defined(CS_MODE)
+  int req_error, senddata_size, header_size, rows_done = 0, error_code = NO_ERROR;
+  char *request, *reply, *senddata, *replydata, *ptr, *row_ptr;
+  OR_ALIGNED_BUF (OR_XASL_ID_SIZE + OR_INT_SIZE * 5) a_request;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  int i, j;
+  const DB_VALUE *dbval;
+
+  request = OR_ALIGNED_BUF_START (a_request);
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  /* make send data: the packed size of each row, followed by the parameter values of the rows */
+  header_size = DB_ALIGN (row_cnt * OR_INT_SIZE, MAX_ALIGNMENT);
+  senddata_size = header_size;
+  for (i = 0, dbval = dbvals; i < row_cnt * dbval_cnt; i++, dbval++)
+    {
+      senddata_size += OR_VALUE_ALIGNED_SIZE ((DB_VALUE *) dbval);
+    }
+
+  senddata = (char *) malloc (senddata_size);
+  if (senddata == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) senddata_size);
+      return 0;
+    }
+  replydata = (char *) malloc (row_cnt * OR_INT_SIZE);
+  if (replydata == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (row_cnt * OR_INT_SIZE));
+      free_and_init (senddata);
+      return 0;
+    }
+
+  ptr = senddata + header_size;
+  for (i = 0, dbval = dbvals; i < row_cnt; i++)
+    {
+      row_ptr = ptr;
+      for (j = 0; j < dbval_cnt; j++, dbval++)
+	{
+	  ptr = or_pack_db_value (ptr, (DB_VALUE *) dbval);
+	}
+      (void) or_pack_int (senddata + i * OR_INT_SIZE, CAST_BUFLEN (ptr - row_ptr));
+    }
+
+  /* change senddata_size as real packing size */
+  senddata_size = CAST_BUFLEN (ptr - senddata);
+
+  ptr = request;
+  OR_PACK_XASL_ID (ptr, xasl_id);
+  ptr = or_pack_int (ptr, dbval_cnt);
+  ptr = or_pack_int (ptr, row_cnt);
+  ptr = or_pack_int (ptr, senddata_size);
+  ptr = or_pack_int (ptr, flag);
+  ptr = or_pack_int (ptr, query_timeout);
+
+  req_error = net_client_request (NET_SERVER_QM_QUERY_EXECUTE_ARRAY, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
+				  OR_ALIGNED_BUF_SIZE (a_reply), senddata, senddata_size, replydata,
+				  row_cnt * OR_INT_SIZE);
+  if (!req_error)
+    {
+      ptr = or_unpack_int (reply, &rows_done);
+      ptr = or_unpack_int (ptr, &error_code);
+      /* the error of the failed row was returned along with the reply */
+      assert (rows_done == row_cnt || error_code != NO_ERROR);
+
+      for (i = 0; i < rows_done; i++)
+	{
+	  (void) or_unpack_int (replydata + i * OR_INT_SIZE, &row_counts[i]);
+	}
+    }
+
+  free_and_init (senddata);
+  free_and_init (replydata);
+
+  return rows_done;
+#else /* CS_MODE */
+  QFILE_LIST_ID *list_id;
+  QUERY_ID query_id;
+  int i;
+
+  for (i = 0; i < row_cnt; i++)
+    {
+      query_id = NULL_QUERY_ID;
+      list_id = qmgr_execute_query (xasl_id, &query_id, dbval_cnt, dbvals + i * dbval_cnt, flag, NULL, NULL,
+				    query_timeout);
+      if (list_id == NULL)
+	{
+	  if (query_id > 0 && er_errid () != ER_LK_UNILATERALLY_ABORTED)
+	    {
+	      er_stack_push ();
+	      (void) qmgr_end_query (query_id);
+	      er_stack_pop ();
+	    }
+	  break;
+	}
+
+      row_counts[i] = list_id->tuple_cnt;
+      cursor_free_self_list_id (list_id);
+      (void) qmgr_end_query (query_id);
+    }
+
+  return i;
+#endif /* !CS_MODE */
+}
+
 /*
  * qmgr_prepare_and_execute_query -
  *
@@ -239,6 +239,8 @@ extern int qmgr_prepare_query (struct compile_context *context, xasl_stream * st
 extern QFILE_LIST_ID *qmgr_execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int dbval_cnt,
 					  const DB_VALUE * dbvals, QUERY_FLAG flag, CACHE_TIME * clt_cache_time,
 					  CACHE_TIME * srv_cache_time, int query_timeout);
+extern int qmgr_execute_query_array (const XASL_ID * xasl_id, int dbval_cnt, int row_cnt, const DB_VALUE * dbvals,
+				     QUERY_FLAG flag, int query_timeout, int *row_counts);
 extern QFILE_LIST_ID *qmgr_prepare_and_execute_query (char *xasl_stream, int xasl_stream_size, QUERY_ID * query_id,
 						      int dbval_cnt, DB_VALUE * dbval_ptr, QUERY_FLAG flag,
 						      int query_timeout);
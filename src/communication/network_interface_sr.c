@@ -5173,6 +5173,135 @@ exit:
     }
 }
 
+/*
+ * sqmgr_execute_query_array - execute a prepared query once for each row of parameter values
+ *
+ * return:
+ *
+ *   thrd(in):
+ *   rid(in):
+ *   request(in):
+ *   reqlen(in):
+ *
+ * NOTE:
+ * Receive XASL file id and the parameter values of several rows, and execute the query for the rows in order,
+ * ending each query right after its execution. The execution stops at the first row that fails, and its error is
+ * returned. The number of rows executed and the tuple count of each of them are returned to the client.
+ * This function is a counter part to qmgr_execute_query_array().
+ */
+void
+sqmgr_execute_query_array (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  XASL_ID xasl_id;
+  QFILE_LIST_ID *list_id;
+  QUERY_ID query_id;
+  QUERY_FLAG query_flag, row_query_flag;
+  CACHE_TIME clt_cache_time;
+  CACHE_TIME srv_cache_time;
+  XASL_CACHE_ENTRY *xasl_cache_entry_p;
+  int csserror, dbval_cnt, row_cnt, data_size, query_timeout, row_size;
+  int rows_done = 0, error_code = NO_ERROR, i;
+  char *ptr, *data = NULL, *row_data, *reply, *replydata;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  bool tran_abort;
+
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  ptr = request;
+  OR_UNPACK_XASL_ID (ptr, &xasl_id);
+  ptr = or_unpack_int (ptr, &dbval_cnt);
+  ptr = or_unpack_int (ptr, &row_cnt);
+  ptr = or_unpack_int (ptr, &data_size);
+  ptr = or_unpack_int (ptr, &query_flag);
+  ptr = or_unpack_int (ptr, &query_timeout);
+
+  xsession_set_tran_auto_commit (thread_p, IS_TRAN_AUTO_COMMIT (query_flag));
+
+  /* receive the size of each row followed by the parameter values (DB_VALUE) of the rows */
+  csserror = css_receive_data_from_client (thread_p->conn_entry, rid, &data, &data_size);
+  if (csserror || data == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+      css_send_abort_to_client (thread_p->conn_entry, rid);
+      if (data)
+	{
+	  free_and_init (data);
+	}
+      return;
+    }
+
+  replydata = (char *) db_private_alloc (thread_p, row_cnt * OR_INT_SIZE);
+  if (replydata == NULL)
+    {
+      css_send_abort_to_client (thread_p->conn_entry, rid);
+      free_and_init (data);
+      return;
+    }
+
+  CACHE_TIME_RESET (&clt_cache_time);
+
+  row_data = data + DB_ALIGN (row_cnt * OR_INT_SIZE, MAX_ALIGNMENT);
+  for (i = 0; i < row_cnt; i++)
+    {
+      (void) or_unpack_int (data + i * OR_INT_SIZE, &row_size);
+
+      query_id = NULL_QUERY_ID;
+      row_query_flag = query_flag;
+      xasl_cache_entry_p = NULL;
+      CACHE_TIME_RESET (&srv_cache_time);
+
+      list_id = xqmgr_execute_query (thread_p, &xasl_id, &query_id, dbval_cnt, row_data, &row_query_flag,
+				     &clt_cache_time, &srv_cache_time, query_timeout, &xasl_cache_entry_p);
+      if (list_id == NULL)
+	{
+	  tran_abort = need_to_abort_tran (thread_p, &error_code);
+	  if (error_code == NO_ERROR)
+	    {
+	      error_code = ER_FAILED;
+	    }
+
+	  if (xasl_cache_entry_p != NULL)
+	    {
+	      /* unfix before return_error_to_client, where the transaction may be aborted */
+	      xcache_unfix (thread_p, xasl_cache_entry_p);
+	      xasl_cache_entry_p = NULL;
+	    }
+
+	  (void) return_error_to_client (thread_p, rid);
+
+	  if (tran_abort == false && query_id > 0)
+	    {
+	      (void) xqmgr_end_query (thread_p, query_id);
+	    }
+	  break;
+	}
+
+      (void) or_pack_int (replydata + i * OR_INT_SIZE, list_id->tuple_cnt);
+
+      /* free QFILE_LIST_ID duplicated by xqmgr_execute_query() */
+      QFILE_FREE_AND_INIT_LIST_ID (list_id);
+      if (xasl_cache_entry_p != NULL)
+	{
+	  xcache_unfix (thread_p, xasl_cache_entry_p);
+	  xasl_cache_entry_p = NULL;
+	}
+      (void) xqmgr_end_query (thread_p, query_id);
+
+      rows_done++;
+      row_data += row_size;
+    }
+
+  free_and_init (data);
+
+  ptr = or_pack_int (reply, rows_done);
+  ptr = or_pack_int (ptr, error_code);
+
+  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), replydata,
+				     row_cnt * OR_INT_SIZE);
+
+  db_private_free_and_init (thread_p, replydata);
+}
+
 /*
  * er_log_slow_query - log slow query to error log file
  * return:
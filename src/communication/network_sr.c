@@ -570,6 +570,11 @@ net_server_init (void)
   req_p->processing_function = sqmgr_execute_query;
   req_p->name = "NET_SERVER_QM_QUERY_EXECUTE";
 
+  req_p = &net_Requests[NET_SERVER_QM_QUERY_EXECUTE_ARRAY];
+  req_p->action_attribute = (SET_DIAGNOSTICS_INFO | IN_TRANSACTION);
+  req_p->processing_function = sqmgr_execute_query_array;
+  req_p->name = "NET_SERVER_QM_QUERY_EXECUTE_ARRAY";
+
   req_p = &net_Requests[NET_SERVER_QM_QUERY_PREPARE_AND_EXECUTE];
   req_p->action_attribute = (SET_DIAGNOSTICS_INFO | IN_TRANSACTION);
   req_p->processing_function = sqmgr_prepare_and_execute_query;
@@ -2879,6 +2879,75 @@ db_execute_and_keep_statement (DB_SESSION * session, int stmt_ndx, DB_QUERY_RESU
   return err;
 }
 
+/*
+ * db_execute_statement_array() - This function executes the compiled
+ *    statement once for each row of host variables, sending all the rows to
+ *    the server in one request. Only an INSERT statement executed by the
+ *    server is supported; for any other statement nothing is executed and
+ *    the caller should execute the rows with db_execute_and_keep_statement().
+ * return : error status of the row that failed, if any
+ * session(in) : contains the SQL query that has been compiled
+ * stmt(in) : int returned by a successful compilation
+ * row_count(in) : number of rows
+ * values(in) : host variables of the rows, row after row
+ * row_counts(out) : number of affected objects of each executed row
+ * rows_done(out) : number of rows executed successfully
+ */
+int
+db_execute_statement_array (DB_SESSION * session, int stmt_ndx, int row_count, DB_VALUE * values, int *row_counts,
+			    int *rows_done)
+{
+  PARSER_CONTEXT *parser;
+  PT_NODE *statement;
+  int err;
+
+  *rows_done = 0;
+
+  CHECK_CONNECT_ERROR ();
+
+  if (!session || !session->parser || !session->statements)
+    {
+      return NO_ERROR;
+    }
+  stmt_ndx--;
+  if (stmt_ndx < 0 || stmt_ndx >= session->dimension || !session->statements[stmt_ndx])
+    {
+      return NO_ERROR;
+    }
+
+  parser = session->parser;
+  statement = session->statements[stmt_ndx];
+
+  /* the server time and the transaction id are filled on the client for each execution */
+  if (session->stage[stmt_ndx] < StatementPreparedStage || statement->si_datetime || statement->si_tran_id
+      || prm_get_integer_value (PRM_ID_XASL_CACHE_MAX_ENTRIES) <= 0 || statement->cannot_prepare)
+    {
+      return NO_ERROR;
+    }
+
+  er_clear ();
+  pt_reset_error (parser);
+  parser->query_id = NULL_QUERY_ID;
+
+  db_invalidate_mvcc_snapshot_before_statement ();
+
+  err = do_execute_insert_array (parser, statement, row_count, values, row_counts, rows_done);
+  if (err == ER_QPROC_XASLNODE_RECOMPILE_REQUESTED || err == ER_QPROC_INVALID_XASLNODE)
+    {
+      /* The cache entry was deleted; leave the recompilation to the execution of the remaining rows. */
+      er_clear ();
+      err = NO_ERROR;
+    }
+
+  if (*rows_done > 0)
+    {
+      session->stage[stmt_ndx] = StatementExecutedStage;
+      update_execution_values (parser, row_counts[*rows_done - 1], CUBRID_STMT_INSERT);
+    }
+
+  return err;
+}
+
 /*
  * db_execute_statement_local() - This function executes the SQL statement
  *    identified by the stmt argument and returns the result. The
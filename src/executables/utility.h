@@ -1245,6 +1245,8 @@ typedef struct _ha_config
 #define LOAD_TABLE_NAME_L                       "table"
 #define LOAD_COMPARE_STORAGE_ORDER_S            11820
 #define LOAD_COMPARE_STORAGE_ORDER_L            "compare-storage-order"
+#define LOAD_DIRECT_LOAD_S                      11821
+#define LOAD_DIRECT_LOAD_L                      "direct-load"
 
 /* unloaddb option list */
 #define UNLOAD_INPUT_CLASS_FILE_S               'i'
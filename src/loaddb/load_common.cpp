@@ -182,6 +182,7 @@ namespace cubload
     , error_file ()
     , ignore_logging (false)
     , compare_storage_order (false)
+    , direct_load (false)
     , table_name ()
     , ignore_class_file ()
     , ignore_classes ()
@@ -211,6 +212,7 @@ namespace cubload
     serializator.pack_string (error_file);
     serializator.pack_bool (ignore_logging);
     serializator.pack_bool (compare_storage_order);
+    serializator.pack_bool (direct_load);
     serializator.pack_string (table_name);
     serializator.pack_string (ignore_class_file);
 
@@ -247,6 +249,7 @@ namespace cubload
     deserializator.unpack_string (error_file);
     deserializator.unpack_bool (ignore_logging);
     deserializator.unpack_bool (compare_storage_order);
+    deserializator.unpack_bool (direct_load);
     deserializator.unpack_string (table_name);
     deserializator.unpack_string (ignore_class_file);
 
@@ -291,6 +294,7 @@ namespace cubload
     size += serializator.get_packed_string_size (error_file, size);
     size += serializator.get_packed_bool_size (size); // ignore_logging
     size += serializator.get_packed_bool_size (size); // compare_storage_order
+    size += serializator.get_packed_bool_size (size); // direct_load
     size += serializator.get_packed_string_size (table_name, size);
     size += serializator.get_packed_string_size (ignore_class_file, size);
 
@@ -110,6 +110,7 @@ namespace cubload
     std::string error_file;
     bool ignore_logging;
     bool compare_storage_order;
+    bool direct_load;
     std::string table_name;
     std::string ignore_class_file;
     std::vector<std::string> ignore_classes;
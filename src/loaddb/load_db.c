@@ -631,6 +631,16 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
       goto error_return;
     }
 
+  /* Disallow syntax only and direct load options together */
+  if (args.direct_load && args.syntax_check)
+    {
+      msg_format = msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_LOADDB, LOADDB_MSG_INCOMPATIBLE_ARGS);
+      print_log_msg (1, msg_format, "--" LOAD_DIRECT_LOAD_L, "--" LOAD_CHECK_ONLY_L);
+      util_log_write_errstr (msg_format, "--" LOAD_DIRECT_LOAD_L, "--" LOAD_CHECK_ONLY_L);
+      status = 1;		/* parsing error */
+      goto error_return;
+    }
+
   if (!args.error_file.empty ())
     {
       if (args.syntax_check)
@@ -674,6 +684,11 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
       print_log_msg (1, "\n--load-only parameter is not supported on Client-Server mode. ");
       print_log_msg (1, "The default behavior of loaddb is loading without checking the file.\n");
     }
+#else /* CS_MODE */
+  if (args.direct_load)
+    {
+      print_log_msg (1, "\n--direct-load parameter is only supported on Client-Server mode and is ignored.\n");
+    }
 #endif
 
   /* if schema file is specified, do schema loading */
@@ -1087,6 +1102,7 @@ get_loaddb_args (UTIL_ARG_MAP * arg_map, load_args * args)
   args->error_file = error_file ? error_file : empty;
   args->ignore_logging = utility_get_option_bool_value (arg_map, LOAD_IGNORE_LOGGING_S);
   args->compare_storage_order = utility_get_option_bool_value (arg_map, LOAD_COMPARE_STORAGE_ORDER_S);
+  args->direct_load = utility_get_option_bool_value (arg_map, LOAD_DIRECT_LOAD_S);
   args->table_name = table_name ? table_name : empty;
   args->ignore_class_file = ignore_class_file ? ignore_class_file : empty;
 }
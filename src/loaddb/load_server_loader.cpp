@@ -177,6 +177,17 @@ namespace cubload
 	return;
       }
 
+    if (m_session.get_args ().direct_load && !is_syntax_check_only)
+      {
+	error_code = check_direct_load (class_name, class_oid, attrinfo);
+	if (error_code != NO_ERROR)
+	  {
+	    heap_attrinfo_end (&thread_ref, &attrinfo);
+	    m_error_handler.on_failure ();
+	    return;
+	  }
+      }
+
     heap_scancache_quick_start_root_hfid (&thread_ref, &scancache);
     SCAN_CODE scan_code = heap_get_class_record (&thread_ref, &class_oid, &recdes, &scancache, PEEK);
     if (scan_code != S_SUCCESS)
@@ -331,6 +342,65 @@ namespace cubload
     assert (*n_attributes >= 0);
   }
 
+  int
+  server_class_installer::check_direct_load (const char *class_name, const OID &class_oid,
+      const heap_cache_attrinfo &attrinfo)
+  {
+    cubthread::entry &thread_ref = cubthread::get_entry ();
+    heap_scancache scancache;
+    hfid hfid;
+    OID first_oid;
+    RECDES recdes = RECDES_INITIALIZER;
+
+    if (m_session.is_direct_load_approved (class_oid))
+      {
+	// approved for an earlier %class block of this session, which may have loaded rows already
+	return NO_ERROR;
+      }
+
+    // Direct load builds heap pages without logging each record and does not maintain indexes. Indexes must be created
+    // after loading (e.g. with --index-file), which builds them sorted in bulk.
+    if (attrinfo.last_classrepr->n_indexes > 0)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_DIRECT_LOAD_NOT_ALLOWED, 1, class_name);
+	return ER_LDR_DIRECT_LOAD_NOT_ALLOWED;
+      }
+
+    int error_code = heap_get_class_info (&thread_ref, &class_oid, &hfid, NULL, NULL);
+    if (error_code != NO_ERROR)
+      {
+	ASSERT_ERROR ();
+	return error_code;
+      }
+
+    error_code = heap_scancache_start (&thread_ref, &scancache, &hfid, &class_oid, true, false, NULL);
+    if (error_code != NO_ERROR)
+      {
+	ASSERT_ERROR ();
+	return error_code;
+      }
+
+    // No snapshot is used, so records that are deleted but not yet vacuumed also count.
+    OID_SET_NULL (&first_oid);
+    SCAN_CODE scan_code = heap_first (&thread_ref, &hfid, const_cast<OID *> (&class_oid), &first_oid, &recdes, &scancache,
+				      PEEK);
+    heap_scancache_end (&thread_ref, &scancache);
+
+    if (scan_code == S_ERROR)
+      {
+	ASSERT_ERROR_AND_SET (error_code);
+	return error_code;
+      }
+    else if (scan_code != S_END)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_DIRECT_LOAD_NOT_ALLOWED, 1, class_name);
+	return ER_LDR_DIRECT_LOAD_NOT_ALLOWED;
+      }
+
+    m_session.approve_direct_load (class_oid);
+    return NO_ERROR;
+  }
+
   bool
   server_class_installer::is_class_ignored (const char *classname)
   {
@@ -554,7 +624,9 @@ namespace cubload
 	return;
       }
 
-    insert_errors_filtered = has_errors_filtered_for_insert (m_session.get_args().m_ignored_errors);
+    // Without indexes there are no unique violations to filter, so direct load always takes the bulk path.
+    insert_errors_filtered = (!m_session.get_args ().direct_load
+			      && has_errors_filtered_for_insert (m_session.get_args().m_ignored_errors));
 
     if (insert_errors_filtered)
       {
@@ -590,10 +662,14 @@ namespace cubload
       }
     else
       {
+	// Direct load was only accepted for empty classes without indexes, so there are no keys to maintain and the
+	// records can be packed into new pages only.
+	bool is_direct_path = m_session.get_args ().direct_load;
+
 	log_sysop_start (m_thread_ref);
 	int error_code = locator_multi_insert_force (m_thread_ref, &m_scancache.node.hfid, &m_scancache.node.class_oid,
-			 m_recdes_collected, true, op_type, &m_scancache, &force_count, pruning_type, NULL, NULL,
-			 UPDATE_INPLACE_NONE, true);
+			 m_recdes_collected, !is_direct_path, op_type, &m_scancache, &force_count, pruning_type, NULL,
+			 NULL, UPDATE_INPLACE_NONE, true, is_direct_path);
 	if (error_code != NO_ERROR)
 	  {
 	    ASSERT_ERROR ();
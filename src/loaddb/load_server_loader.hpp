@@ -67,6 +67,7 @@ namespace cubload
       void register_class_with_attributes (const char *class_name, class_command_spec_type *cmd_spec);
       void get_class_attributes (heap_cache_attrinfo &attrinfo, attribute_type attr_type, or_attribute *&or_attributes,
 				 int *n_attributes);
+      int check_direct_load (const char *class_name, const OID &class_oid, const heap_cache_attrinfo &attrinfo);
   };
 
   class server_object_loader : public object_loader
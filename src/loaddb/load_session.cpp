@@ -239,6 +239,7 @@ namespace cubload
     , m_max_batch_id {NULL_BATCH_ID}
     , m_active_task_count {0}
     , m_class_registry ()
+    , m_direct_load_classes ()
     , m_stats ()
     , m_is_failed (false)
     , m_collected_stats ()
@@ -510,6 +511,36 @@ namespace cubload
     return m_class_registry;
   }
 
+  bool
+  session::is_direct_load_approved (const OID &class_oid)
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+
+    for (const OID &approved_oid : m_direct_load_classes)
+      {
+	if (OID_EQ (&approved_oid, &class_oid))
+	  {
+	    return true;
+	  }
+      }
+    return false;
+  }
+
+  void
+  session::approve_direct_load (const OID &class_oid)
+  {
+    std::unique_lock<std::mutex> ulock (m_mutex);
+
+    for (const OID &approved_oid : m_direct_load_classes)
+      {
+	if (OID_EQ (&approved_oid, &class_oid))
+	  {
+	    return;
+	  }
+      }
+    m_direct_load_classes.push_back (class_oid);
+  }
+
   const load_args &
   session::get_args ()
   {
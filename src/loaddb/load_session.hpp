@@ -125,6 +125,13 @@ namespace cubload
 
       class_registry &get_class_registry ();
 
+      /*
+       * Classes that passed the direct load checks. The checks are done once per session, since later %class blocks
+       * of the same class find the rows loaded by the previous ones.
+       */
+      bool is_direct_load_approved (const OID &class_oid);
+      void approve_direct_load (const OID &class_oid);
+
       template<typename... Args>
       void append_log_msg (MSGCAT_LOADDB_MSG msg_id, Args &&... args);
 
@@ -146,6 +153,7 @@ namespace cubload
       std::atomic<size_t> m_active_task_count;    // note: all decrements need to be protected by mutex
 
       class_registry m_class_registry;
+      std::vector<OID> m_direct_load_classes;
 
       stats m_stats; // load db stats
       bool m_is_failed;
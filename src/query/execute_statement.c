@@ -13563,6 +13563,128 @@ do_execute_insert (PARSER_CONTEXT * parser, PT_NODE * statement)
   return err;
 }
 
+/*
+ * do_execute_insert_array () - Execute the prepared INSERT statement once for
+ *				each row of host variables
+ *   return: Error code
+ *   parser(in): Parser context
+ *   statement(in):
+ *   row_cnt(in): Number of rows
+ *   values(in): Host variables of the rows, parser->host_var_count per row
+ *   row_counts(out): Number of inserted objects of each executed row
+ *   rows_done(out): Number of rows executed successfully
+ *
+ * Note: The rows are sent to the server and executed there by one request.
+ *	 The execution stops at the first row whose execution fails, and the
+ *	 error is returned. It also stops before a row whose values cannot be
+ *	 bound, without error, so that the caller executes the remaining rows
+ *	 one by one. A statement that needs work on the client between the
+ *	 rows is not executed at all.
+ *	 Only a server-side insert is executed, so no inserted object is
+ *	 returned for the rows, just as for a single server-side insert.
+ */
+int
+do_execute_insert_array (PARSER_CONTEXT * parser, PT_NODE * statement, int row_cnt, DB_VALUE * values,
+			 int *row_counts, int *rows_done)
+{
+  int err = NO_ERROR;
+  int var_cnt, row_var_cnt, bound_rows, has_trigger = 0;
+  int i, j;
+  PT_NODE *flat;
+  DB_OBJECT *class_obj;
+  DB_VALUE *row_values;
+  QUERY_FLAG query_flag;
+  LC_FETCH_VERSION_TYPE read_fetch_instance_version;
+
+  assert (parser->query_id == NULL_QUERY_ID);
+
+  *rows_done = 0;
+
+  CHECK_MODIFICATION_ERROR ();
+
+  if (statement->node_type != PT_INSERT || statement->info.insert.server_allowed != SERVER_INSERT_IS_ALLOWED
+      || statement->xasl_id == NULL || statement->use_auto_commit
+      || parser->is_auto_commit || parser->return_generated_keys || qo_need_skip_execution ()
+      || (!HA_DISABLED () && is_stmt_based_repl_type (statement)))
+    {
+      return NO_ERROR;
+    }
+
+  /* statement triggers are raised on the client for each execution */
+  flat = statement->info.insert.spec->info.spec.flat_entity_list;
+  class_obj = (flat) ? flat->info.name.db_object : NULL;
+  if (class_obj == NULL || sm_class_has_triggers (class_obj, &has_trigger, TR_EVENT_ALL) != NO_ERROR || has_trigger)
+    {
+      er_clear ();
+      return NO_ERROR;
+    }
+
+  var_cnt = parser->host_var_count;
+  row_var_cnt = parser->host_var_count + parser->auto_param_count;
+  if (var_cnt <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  row_values = (DB_VALUE *) malloc (row_cnt * row_var_cnt * sizeof (DB_VALUE));
+  if (row_values == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) (row_cnt * row_var_cnt * sizeof (DB_VALUE)));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  /* cast the values of each row to the expected domains, like db_push_values () does for a single execution */
+  for (bound_rows = 0; bound_rows < row_cnt; bound_rows++)
+    {
+      pt_set_host_variables (parser, var_cnt, values + bound_rows * var_cnt);
+      if (parser->set_host_var == 0)
+	{
+	  /* leave the error to the execution of this row by the caller */
+	  pt_reset_error (parser);
+	  break;
+	}
+
+      for (j = 0; j < row_var_cnt; j++)
+	{
+	  pr_clone_value (&parser->host_variables[j], &row_values[bound_rows * row_var_cnt + j]);
+	}
+    }
+
+  if (bound_rows > 0)
+    {
+      query_flag = DEFAULT_EXEC_MODE;
+
+      query_flag |= NOT_FROM_RESULT_CACHE;
+      query_flag |= RESULT_CACHE_INHIBITED;
+
+      if (parser->is_xasl_pinned_reference)
+	{
+	  query_flag |= XASL_CACHE_PINNED_REFERENCE;
+	}
+
+      read_fetch_instance_version = TM_TRAN_READ_FETCH_VERSION ();
+      db_set_read_fetch_instance_version (LC_FETCH_MVCC_VERSION);
+
+      *rows_done = execute_query_array (statement->xasl_id, row_var_cnt, bound_rows, row_values, query_flag,
+					row_counts);
+      if (*rows_done < bound_rows)
+	{
+	  err = ((err = er_errid ()) == NO_ERROR) ? ER_FAILED : err;
+	}
+
+      db_set_read_fetch_instance_version (read_fetch_instance_version);
+    }
+
+  for (i = 0; i < bound_rows * row_var_cnt; i++)
+    {
+      pr_clear_value (&row_values[i]);
+    }
+  free_and_init (row_values);
+
+  return err;
+}
+
 /*
  * Function Group:
  * Implement method calls
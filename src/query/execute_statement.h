@@ -104,6 +104,8 @@ extern int do_alter_user (const PARSER_CONTEXT * parser, const PT_NODE * stateme
 extern int do_insert (PARSER_CONTEXT * parser, PT_NODE * statement);
 extern int do_prepare_insert (PARSER_CONTEXT * parser, PT_NODE * statement);
 extern int do_execute_insert (PARSER_CONTEXT * parser, PT_NODE * statement);
+extern int do_execute_insert_array (PARSER_CONTEXT * parser, PT_NODE * statement, int row_cnt, DB_VALUE * values,
+				    int *row_counts, int *rows_done);
 
 extern int do_call_method (PARSER_CONTEXT * parser, PT_NODE * statement);
 extern void do_print_classname_on_method (DB_OBJECT * self, DB_VALUE * result);
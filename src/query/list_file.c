@@ -40,6 +40,7 @@
 #include "log_append.hpp"
 #include "object_primitive.h"
 #include "object_representation.h"
+#include "perf_monitor.h"
 #include "query_manager.h"
 #include "query_opfunc.h"
 #include "stream_to_xasl.h"
@@ -94,26 +95,28 @@ struct qfile_list_cache
   QFILE_LIST_CACHE_ENTRY **tran_list;	/* array[MAX_NTRANS] of list per trx */
   int n_entries;		/* total number of cache entries */
   int n_pages;			/* total number of pages used by the cache */
+  INT64 n_bytes;		/* total number of bytes accounted to the cache entries */
+  QFILE_LIST_CACHE_ENTRY *lru_head;	/* most recently used entry */
+  QFILE_LIST_CACHE_ENTRY *lru_tail;	/* least recently used entry; the first eviction victim */
   unsigned int lookup_counter;	/* counter of cache lookup */
   unsigned int hit_counter;	/* counter of cache hit */
   unsigned int miss_counter;	/* counter of cache miss */
+  unsigned int stale_counter;	/* counter of entries found invalidated by a class modification */
   unsigned int full_counter;	/* counter of cache full & replacement */
 };
 
-typedef struct qfile_list_cache_candidate QFILE_LIST_CACHE_CANDIDATE;
-struct qfile_list_cache_candidate
-{
-  int total_num;		/* total number of cache entries */
-  int num_candidates;		/* number of candidates */
-  int num_victims;		/* number of victims */
-  int selcnt;
-  QFILE_LIST_CACHE_ENTRY **time_candidates;	/* candidates who are old aged */
-  QFILE_LIST_CACHE_ENTRY **ref_candidates;	/* candidates who are recently used */
-  QFILE_LIST_CACHE_ENTRY **victims;	/* victims; cache entries to be deleted */
-  int c_idx;
-  int v_idx;
-  bool include_in_use;
-};
+/*
+ * Class modification versions of the list cache.
+ *
+ * Instead of flushing the cached results of a class when it is modified, the class is given a new version taken from
+ * a global clock. A cached result remembers the clock value read before its query was executed and is found stale at
+ * lookup when one of the classes the query depends on has a newer version. Classes are mapped to a fixed number of
+ * version slots; two classes sharing a slot only cause some extra invalidations.
+ */
+#define QFILE_LIST_CACHE_CLASS_VERSION_SLOTS 4096
+
+#define QFILE_LIST_CACHE_CLASS_VERSION_SLOT(class_oid) \
+  (OID_PSEUDO_KEY (class_oid) % QFILE_LIST_CACHE_CLASS_VERSION_SLOTS)
 
 /* list cache entry pooling */
 #define FIXED_SIZE_OF_POOLED_LIST_CACHE_ENTRY   4096
@@ -153,10 +156,11 @@ struct qfile_list_cache_entry_pool
  */
 
 /* list cache and related information */
-static QFILE_LIST_CACHE qfile_List_cache = { NULL, NULL, 0, 0, NULL, 0, 0, 0, 0, 0, 0 };
+static QFILE_LIST_CACHE qfile_List_cache = { NULL, NULL, 0, 0, NULL, 0, 0, 0, NULL, NULL, 0, 0, 0, 0, 0 };
 
-/* information of candidates to be removed from XASL cache */
-static QFILE_LIST_CACHE_CANDIDATE qfile_List_cache_candidate = { 0, 0, 0, 0, NULL, NULL, NULL, 0, 0, false };
+/* list cache clock and class modification versions */
+static volatile UINT64 qfile_List_cache_clock = 0;
+static volatile UINT64 qfile_List_cache_class_versions[QFILE_LIST_CACHE_CLASS_VERSION_SLOTS];
 
 /* list cache entry pool */
 static QFILE_LIST_CACHE_ENTRY_POOL qfile_List_cache_entry_pool = { NULL, 0, 0 };
@@ -268,9 +272,9 @@ static void qfile_add_uncommitted_list_cache_entry (int tran_index, QFILE_LIST_C
 static void qfile_delete_uncommitted_list_cache_entry (int tran_index, QFILE_LIST_CACHE_ENTRY * lent);
 static int qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args);
 static int qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, void *data, void *args);
-static bool qfile_is_early_time (struct timeval *a, struct timeval *b);
-
-static int qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args);
+static void qfile_link_list_cache_entry_lru (QFILE_LIST_CACHE_ENTRY * lent);
+static void qfile_unlink_list_cache_entry_lru (QFILE_LIST_CACHE_ENTRY * lent);
+static void qfile_evict_list_cache_entries (THREAD_ENTRY * thread_p, INT64 req_bytes, int tran_index);
 
 static int qfile_get_list_cache_entry_size_for_allocate (int nparam);
 #if defined(SERVER_MODE)
@@ -4851,9 +4855,13 @@ qfile_initialize_list_cache (THREAD_ENTRY * thread_p)
     }
   qfile_List_cache.n_entries = 0;
   qfile_List_cache.n_pages = 0;
+  qfile_List_cache.n_bytes = 0;
+  qfile_List_cache.lru_head = NULL;
+  qfile_List_cache.lru_tail = NULL;
   qfile_List_cache.lookup_counter = 0;
   qfile_List_cache.hit_counter = 0;
   qfile_List_cache.miss_counter = 0;
+  qfile_List_cache.stale_counter = 0;
   qfile_List_cache.full_counter = 0;
 
   /* list cache entry pool */
@@ -5265,6 +5273,8 @@ qfile_print_list_cache_entry (THREAD_ENTRY * thread_p, FILE * fp, const void *ke
 
       fprintf (fp, "  ref_count = %d\n", ent->ref_count);
       fprintf (fp, "  deletion_marker = %s\n", (ent->deletion_marker) ? "true" : "false");
+      fprintf (fp, "  version = %llu\n", (unsigned long long) ent->version);
+      fprintf (fp, "  n_bytes = %lld\n", (long long) ent->n_bytes);
       fprintf (fp, "}\n");
     }
 
@@ -5292,11 +5302,13 @@ qfile_dump_list_cache_internal (THREAD_ENTRY * thread_p, FILE * fp)
     }
 
   fprintf (fp,
-	   "LIST_CACHE {\n  n_hts %d\n  n_entries %d  n_pages %d\n"
-	   "  lookup_counter %d\n  hit_counter %d\n  miss_counter %d\n  full_counter %d\n}\n",
+	   "LIST_CACHE {\n  n_hts %d\n  n_entries %d  n_pages %d  n_bytes %lld\n"
+	   "  lookup_counter %d\n  hit_counter %d\n  miss_counter %d\n  stale_counter %d\n  full_counter %d\n"
+	   "  clock %llu\n}\n",
 	   qfile_List_cache.n_hts, qfile_List_cache.n_entries, qfile_List_cache.n_pages,
-	   qfile_List_cache.lookup_counter, qfile_List_cache.hit_counter, qfile_List_cache.miss_counter,
-	   qfile_List_cache.full_counter);
+	   (long long) qfile_List_cache.n_bytes, qfile_List_cache.lookup_counter, qfile_List_cache.hit_counter,
+	   qfile_List_cache.miss_counter, qfile_List_cache.stale_counter, qfile_List_cache.full_counter,
+	   (unsigned long long) qfile_get_list_cache_clock ());
 
   for (i = 0; i < qfile_List_cache.n_hts; i++)
     {
@@ -5473,6 +5485,10 @@ qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
       /* update counter */
       qfile_List_cache.n_entries--;
       qfile_List_cache.n_pages -= lent->list_id.page_cnt;
+      qfile_List_cache.n_bytes -= lent->n_bytes;
+
+      /* remove the entry from the LRU list */
+      qfile_unlink_list_cache_entry_lru (lent);
 
       /* remove the entry from the hash table */
       if (mht_rem2 (qfile_List_cache.list_hts[lent->list_ht_no], &lent->param_values, lent, NULL, NULL) != NO_ERROR)
@@ -5535,12 +5551,15 @@ qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, void *data, vo
  *   return:
  *   list_ht_no(in)     :
  *   params(in) :
+ *   min_version(in)    : newest modification version of the classes the query depends on
  *
  * Note: Look up the hash table to get the cached result with the parameter
- *       values as the key.
+ *       values as the key. An entry made before min_version was given to
+ *       one of the related classes is stale; it is deleted instead of returned.
  */
 QFILE_LIST_CACHE_ENTRY *
-qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB_VALUE_ARRAY * params)
+qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB_VALUE_ARRAY * params,
+			       UINT64 min_version)
 {
   QFILE_LIST_CACHE_ENTRY *lent;
   int tran_index;
@@ -5575,12 +5594,28 @@ qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
   /* look up the hash table with the key */
   lent = (QFILE_LIST_CACHE_ENTRY *) mht_get (qfile_List_cache.list_hts[list_ht_no], params);
   qfile_List_cache.lookup_counter++;	/* counter */
+  perfmon_inc_stat (thread_p, PSTAT_QC_NUM_LOOKUP);
   if (lent)
     {
+      /* check if one of the related classes was modified after the result was made */
+      if (!lent->deletion_marker && lent->version < min_version)
+	{
+	  qfile_List_cache.stale_counter++;	/* counter */
+	  perfmon_inc_stat (thread_p, PSTAT_QC_NUM_STALE);
+	  lent->deletion_marker = true;
+	}
+
       /* check if it is marked to be deleted */
       if (lent->deletion_marker)
 	{
-	  (void) qfile_delete_list_cache_entry (thread_p, lent, &tran_index);
+#if defined(SERVER_MODE)
+	  /* an uncommitted entry is linked in the list of the transaction that made it; it is deleted by the next
+	   * lookup after the transaction ends */
+	  if (!lent->uncommitted_marker)
+#endif /* SERVER_MODE */
+	    {
+	      (void) qfile_delete_list_cache_entry (thread_p, lent, &tran_index);
+	    }
 	  lent = NULL;
 	}
 #if defined(SERVER_MODE)
@@ -5645,15 +5680,21 @@ qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
 #endif /* SERVER_MODE */
 	  (void) gettimeofday (&lent->time_last_used, NULL);
 	  lent->ref_count++;
+
+	  /* make it the most recently used one */
+	  qfile_unlink_list_cache_entry_lru (lent);
+	  qfile_link_list_cache_entry_lru (lent);
 	}
     }
   if (lent)
     {
       qfile_List_cache.hit_counter++;	/* counter */
+      perfmon_inc_stat (thread_p, PSTAT_QC_NUM_HIT);
     }
   else
     {
       qfile_List_cache.miss_counter++;	/* counter */
+      perfmon_inc_stat (thread_p, PSTAT_QC_NUM_MISS);
     }
 
   csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
@@ -5661,118 +5702,118 @@ qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
   return lent;
 }
 
-static bool
-qfile_is_early_time (struct timeval *a, struct timeval *b)
+/*
+ * qfile_link_list_cache_entry_lru () - Put the entry at the head (most recently used end) of the LRU list
+ *   return:
+ *   lent(in/out)   :
+ */
+static void
+qfile_link_list_cache_entry_lru (QFILE_LIST_CACHE_ENTRY * lent)
 {
-  if (a->tv_sec == b->tv_sec)
+  /* this function should be called within CSECT_QPROC_LIST_CACHE */
+  assert (lent->lru_prev == NULL && lent->lru_next == NULL && qfile_List_cache.lru_head != lent);
+
+  lent->lru_next = qfile_List_cache.lru_head;
+  if (qfile_List_cache.lru_head != NULL)
     {
-      return a->tv_usec < b->tv_usec;
+      qfile_List_cache.lru_head->lru_prev = lent;
     }
-  else
+  qfile_List_cache.lru_head = lent;
+  if (qfile_List_cache.lru_tail == NULL)
     {
-      return a->tv_sec < b->tv_sec;
+      qfile_List_cache.lru_tail = lent;
     }
 }
 
 /*
- * qfile_select_list_cache_entry () - Select candidates to remove from the list cache
- *                               Will be used by mht_map_no_key() function
+ * qfile_unlink_list_cache_entry_lru () - Remove the entry from the LRU list
  *   return:
- *   data(in)   :
- *   args(in/out)   :
+ *   lent(in/out)   :
+ *
+ * Note: Does nothing if the entry is not linked.
  */
-static int
-qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
+static void
+qfile_unlink_list_cache_entry_lru (QFILE_LIST_CACHE_ENTRY * lent)
 {
-  QFILE_LIST_CACHE_ENTRY *lent = (QFILE_LIST_CACHE_ENTRY *) data;
-  QFILE_LIST_CACHE_CANDIDATE *info = (QFILE_LIST_CACHE_CANDIDATE *) args;
-  QFILE_LIST_CACHE_ENTRY **p, **q;
-  int i;
-  size_t n;
-
-#if defined(SERVER_MODE)
-  if (info->include_in_use == false && lent->last_ta_idx > 0)
+  /* this function should be called within CSECT_QPROC_LIST_CACHE */
+  if (lent->lru_prev != NULL)
     {
-      /* do not select one that is in use */
-      return NO_ERROR;
+      lent->lru_prev->lru_next = lent->lru_next;
     }
-  if (info->include_in_use == true && lent->last_ta_idx == 0)
+  else if (qfile_List_cache.lru_head == lent)
     {
-      /* this entry may be selected in the previous selection step */
-      return NO_ERROR;
+      qfile_List_cache.lru_head = lent->lru_next;
+    }
+  else
+    {
+      /* not linked */
+      assert (lent->lru_next == NULL);
+      return;
     }
-#endif /* SERVER_MODE */
-
-  p = info->time_candidates;
-  q = info->ref_candidates;
-  i = 0;
 
-  while (i < info->c_idx && (p || q))
+  if (lent->lru_next != NULL)
     {
-      if (p && qfile_is_early_time (&(lent->time_created), &((*p)->time_created)))
-	{
-	  if (info->c_idx < info->num_candidates)
-	    {
-	      n = sizeof (QFILE_LIST_CACHE_ENTRY *) * (info->c_idx - i);
-	    }
-	  else
-	    {
-	      n = sizeof (QFILE_LIST_CACHE_ENTRY *) * (info->c_idx - i - 1);
-	    }
-	  (void) memmove (p + 1, p, n);
-	  *p = lent;
-	  p = NULL;
-	}
-      else if (p)
-	{
-	  p++;
-	}
+      lent->lru_next->lru_prev = lent->lru_prev;
+    }
+  else
+    {
+      assert (qfile_List_cache.lru_tail == lent);
+      qfile_List_cache.lru_tail = lent->lru_prev;
+    }
 
-      if (q && lent->ref_count < (*q)->ref_count)
-	{
-	  if (info->c_idx < info->num_candidates)
-	    {
-	      n = sizeof (QFILE_LIST_CACHE_ENTRY *) * (info->c_idx - i);
-	    }
-	  else
-	    {
-	      n = sizeof (QFILE_LIST_CACHE_ENTRY *) * (info->c_idx - i - 1);
-	    }
+  lent->lru_prev = NULL;
+  lent->lru_next = NULL;
+}
 
-	  (void) memmove (q + 1, q, n);
-	  *q = lent;
-	  q = NULL;
-	}
-      else if (q)
-	{
-	  q++;
-	}
+/*
+ * qfile_evict_list_cache_entries () - Delete least recently used entries until a new entry fits in the cache
+ *   return:
+ *   req_bytes(in)      : bytes of the entry to be added
+ *   tran_index(in)     :
+ *
+ * Note: The cache is limited by the number of entries and by the bytes of its entries; the page limit of the list
+ *       cache is accounted in bytes so that the memory of the entries (parameter values, transaction arrays) is
+ *       charged as well as the result pages. Entries in use by other transactions are skipped.
+ */
+static void
+qfile_evict_list_cache_entries (THREAD_ENTRY * thread_p, INT64 req_bytes, int tran_index)
+{
+  /* this function should be called within CSECT_QPROC_LIST_CACHE */
+  QFILE_LIST_CACHE_ENTRY *victim, *prev;
+  int max_entries;
+  INT64 max_bytes;
+
+  max_entries = prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES);
+  max_bytes = (INT64) prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES) * DB_PAGESIZE;
 
-      i++;
+  if (qfile_List_cache.n_entries < max_entries && qfile_List_cache.n_bytes + req_bytes <= max_bytes)
+    {
+      return;
     }
 
-  if (info->c_idx < info->num_candidates)
+  qfile_List_cache.full_counter++;	/* counter */
+
+  for (victim = qfile_List_cache.lru_tail; victim != NULL; victim = prev)
     {
-      if (p)
+      if (qfile_List_cache.n_entries < max_entries && qfile_List_cache.n_bytes + req_bytes <= max_bytes)
 	{
-	  *p = lent;
+	  break;
 	}
 
-      if (q)
+      prev = victim->lru_prev;
+#if defined(SERVER_MODE)
+      if (victim->last_ta_idx > 0 || victim->uncommitted_marker)
 	{
-	  *q = lent;
+	  /* do not evict one that is in use or not committed yet */
+	  continue;
 	}
+#endif /* SERVER_MODE */
 
-      info->c_idx++;
-    }
-
-  if (--info->selcnt <= 0)
-    {
-      /* due to the performance reason, stop traversing here */
-      return ER_FAILED;
+      if (qfile_delete_list_cache_entry (thread_p, victim, &tran_index) == NO_ERROR)
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_QC_NUM_EVICT);
+	}
     }
-
-  return NO_ERROR;
 }
 
 /*
@@ -5783,6 +5824,7 @@ qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
  *   params(in) :
  *   list_id(in)        :
  *   query_string(in)   :
+ *   version(in)        : list cache clock read before the query was executed
  *
  * Note: Put the query result into the proper hash table with the key of
  *       the parameter values (DB_VALUE array) and the data of LIST ID.
@@ -5791,9 +5833,9 @@ qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
  */
 QFILE_LIST_CACHE_ENTRY *
 qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, const DB_VALUE_ARRAY * params,
-			       const QFILE_LIST_ID * list_id, const char *query_string)
+			       const QFILE_LIST_ID * list_id, const char *query_string, UINT64 version)
 {
-  QFILE_LIST_CACHE_ENTRY *lent, *old, **p, **q, **r;
+  QFILE_LIST_CACHE_ENTRY *lent;
   MHT_TABLE *ht;
   int tran_index;
 #if defined(SERVER_MODE)
@@ -5807,10 +5849,10 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
   size_t i_idx, num_active_users;
 #endif
 #endif /* SERVER_MODE */
-  unsigned int n;
   HL_HEAPID old_pri_heap_id;
-  int i, j, k;
+  int i;
   int alloc_size;
+  INT64 req_bytes;
 
   if (QFILE_IS_LIST_CACHE_DISABLED)
     {
@@ -5909,6 +5951,10 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
 #endif /* SERVER_MODE */
       (void) gettimeofday (&lent->time_last_used, NULL);
       lent->ref_count++;
+
+      /* make it the most recently used one */
+      qfile_unlink_list_cache_entry_lru (lent);
+      qfile_link_list_cache_entry_lru (lent);
     }
   while (0);
 
@@ -5918,120 +5964,14 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
       goto end;
     }
 
-  /* check the number of list cache entries */
-  if ((int) mht_count (ht) >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
-      || qfile_List_cache.n_entries >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
-      || qfile_List_cache.n_pages >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES))
-    {
-
-      qfile_List_cache.full_counter++;	/* counter */
-
-      /* at first, examine hash entries to selet candidates */
-      qfile_List_cache_candidate.c_idx = 0;
-      qfile_List_cache_candidate.v_idx = 0;
-      qfile_List_cache_candidate.selcnt = qfile_List_cache_candidate.num_candidates;
-      /* at first, try to find candidates within entries that is not in use */
-      qfile_List_cache_candidate.include_in_use = false;
-
-      /* select candidates from all hash tables */
-      for (n = 0; n < qfile_List_cache.n_hts; n++)
-	{
-	  if (qfile_List_cache.ht_assigned[n])
-	    {
-	      (void) mht_map_no_key (thread_p, qfile_List_cache.list_hts[n], qfile_select_list_cache_entry,
-				     &qfile_List_cache_candidate);
-	    }
-	}
-      if (qfile_List_cache_candidate.c_idx < qfile_List_cache_candidate.num_candidates)
-	{
-	  /* insufficient candidates; try once more */
-	  qfile_List_cache_candidate.include_in_use = true;
-	  for (n = 0; n < qfile_List_cache.n_hts; n++)
-	    {
-	      if (qfile_List_cache.ht_assigned[n])
-		{
-		  (void) mht_map_no_key (thread_p, qfile_List_cache.list_hts[n], qfile_select_list_cache_entry,
-					 &qfile_List_cache_candidate);
-		}
-	    }
-	}
-
-      /* find victims who appears in both groups */
-      k = qfile_List_cache_candidate.v_idx;
-      r = qfile_List_cache_candidate.victims;
-      for (i = 0, p = qfile_List_cache_candidate.time_candidates; i < qfile_List_cache_candidate.num_candidates;
-	   i++, p++)
-	{
-	  for (j = 0, q = qfile_List_cache_candidate.ref_candidates; j < qfile_List_cache_candidate.num_candidates;
-	       j++, q++)
-	    {
-	      if (*p && *q && *p == *q && k < qfile_List_cache_candidate.num_victims)
-		{
-		  *r++ = *p;
-		  k++;
-		  *p = *q = NULL;
-		  break;
-		}
-	    }
-	  if (k >= qfile_List_cache_candidate.num_victims)
-	    {
-	      break;
-	    }
-	}
-
-      /* select more victims if insufficient */
-      if (k < qfile_List_cache_candidate.num_victims)
-	{
-	  /*
-	   * The above victim selection algorithm is not completed yet.
-	   * Two double linked lists for list cache entries are needed to
-	   * implement the algorithm efficiently. One for creation time, and
-	   * the other one for referencing.
-	   * Instead, select from most significant members from each groups.
-	   */
-	  p = qfile_List_cache_candidate.time_candidates;
-	  q = qfile_List_cache_candidate.ref_candidates;
-	  for (i = 0; i < qfile_List_cache_candidate.num_candidates; i++)
-	    {
-	      if (*p)
-		{
-		  *r++ = *p;
-		  k++;
-		  *p = NULL;
-		  if (k >= qfile_List_cache_candidate.num_victims)
-		    {
-		      break;
-		    }
-		}
-	      if (*q)
-		{
-		  *r++ = *q;
-		  k++;
-		  *q = NULL;
-		  if (k >= qfile_List_cache_candidate.num_victims)
-		    {
-		      break;
-		    }
-		}
-	      p++, q++;
-	    }
-	}
-      qfile_List_cache_candidate.c_idx = 0;
-      qfile_List_cache_candidate.v_idx = k;
-
-      /* now, delete victims from the cache */
-      for (k = 0, r = qfile_List_cache_candidate.victims; k < qfile_List_cache_candidate.v_idx; k++, r++)
-	{
-	  old = *r;
-	  (void) qfile_delete_list_cache_entry (thread_p, old, &tran_index);
-	}
-      qfile_List_cache_candidate.v_idx = 0;
-    }
+  /* make room for the new entry by evicting the least recently used ones */
+  alloc_size = qfile_get_list_cache_entry_size_for_allocate (params->size);
+  req_bytes = (INT64) alloc_size + (INT64) list_id->page_cnt * DB_PAGESIZE;
+  qfile_evict_list_cache_entries (thread_p, req_bytes, tran_index);
 
   /* make new QFILE_LIST_CACHE_ENTRY */
 
   /* get new entry from the QFILE_LIST_CACHE_ENTRY_POOL */
-  alloc_size = qfile_get_list_cache_entry_size_for_allocate (params->size);
   lent = qfile_allocate_list_cache_entry (alloc_size);
   if (lent == NULL)
     {
@@ -6075,6 +6015,7 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
   (void) gettimeofday (&lent->time_last_used, NULL);
   lent->ref_count = 0;
   lent->deletion_marker = false;
+  lent->version = version;
 
   /* record my transaction id into the entry */
 #if defined(SERVER_MODE)
@@ -6122,6 +6063,10 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
   /* update counter */
   qfile_List_cache.n_entries++;
   qfile_List_cache.n_pages += lent->list_id.page_cnt;
+  lent->n_bytes = req_bytes;
+  qfile_List_cache.n_bytes += lent->n_bytes;
+
+  qfile_link_list_cache_entry_lru (lent);
 
 end:
   csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
@@ -6245,6 +6190,70 @@ qfile_get_list_cache_entry_param_values (QFILE_LIST_CACHE_ENTRY * ent)
 #endif /* SERVER_MODE */
 }
 
+/*
+ * qfile_get_list_cache_entry_count () - Get the number of list cache entries
+ *   return: number of entries
+ */
+int
+qfile_get_list_cache_entry_count (void)
+{
+  return qfile_List_cache.n_entries;
+}
+
+/*
+ * qfile_get_list_cache_clock () - Get the current list cache clock
+ *   return: clock value
+ *
+ * Note: A query reads the clock before it is executed; its result is valid for
+ *       as long as none of the classes it depends on gets a newer version.
+ */
+UINT64
+qfile_get_list_cache_clock (void)
+{
+  return ATOMIC_LOAD_64 (&qfile_List_cache_clock);
+}
+
+/*
+ * qfile_get_list_cache_class_version () - Get the modification version of a class
+ *   return: version of the last modification of the class (or of a class sharing its slot)
+ *   class_oid(in)      :
+ */
+UINT64
+qfile_get_list_cache_class_version (const OID * class_oid)
+{
+  return ATOMIC_LOAD_64 (&qfile_List_cache_class_versions[QFILE_LIST_CACHE_CLASS_VERSION_SLOT (class_oid)]);
+}
+
+/*
+ * qfile_advance_list_cache_class_version () - Give a class a new modification version
+ *   return:
+ *   class_oid(in)      :
+ *
+ * Note: Cached results made before the call are found stale by the next
+ *       lookup. The caller must make the modification visible to new
+ *       snapshots before advancing the version.
+ */
+void
+qfile_advance_list_cache_class_version (const OID * class_oid)
+{
+  volatile UINT64 *slot_p;
+  UINT64 old_version, new_version;
+
+  slot_p = &qfile_List_cache_class_versions[QFILE_LIST_CACHE_CLASS_VERSION_SLOT (class_oid)];
+  new_version = ATOMIC_INC_64 (&qfile_List_cache_clock, 1);
+
+  /* versions of a slot only move forward */
+  do
+    {
+      old_version = ATOMIC_LOAD_64 (slot_p);
+      if (old_version >= new_version)
+	{
+	  break;
+	}
+    }
+  while (!ATOMIC_CAS_64 (slot_p, old_version, new_version));
+}
+
 /*
  * qfile_add_tuple_get_pos_in_list () - The given tuple is added to the end of
  *    the list file. The position in the list file is returned.
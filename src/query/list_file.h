@@ -96,6 +96,11 @@ struct qfile_list_cache_entry
   struct timeval time_last_used;	/* when this entry used lastly */
   int ref_count;		/* how many times this query used */
   bool deletion_marker;		/* this entry will be deleted if marker set */
+  UINT64 version;		/* list cache clock read before the query was executed; the entry is stale once any
+				 * related class has a newer modification version */
+  INT64 n_bytes;		/* bytes (entry memory and result pages) accounted to the cache for this entry */
+  QFILE_LIST_CACHE_ENTRY *lru_prev;	/* more recently used entry */
+  QFILE_LIST_CACHE_ENTRY *lru_next;	/* less recently used entry */
 };
 
 enum
@@ -159,11 +164,16 @@ extern int qfile_dump_list_cache (THREAD_ENTRY * thread_p, const char *fname);
 /* query result(list file) cache entry manipulation functions */
 void qfile_clear_uncommited_list_cache_entry (THREAD_ENTRY * thread_p, int tran_index);
 QFILE_LIST_CACHE_ENTRY *qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no,
-						       const DB_VALUE_ARRAY * params);
+						       const DB_VALUE_ARRAY * params, UINT64 min_version);
 QFILE_LIST_CACHE_ENTRY *qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr,
 						       const DB_VALUE_ARRAY * params, const QFILE_LIST_ID * list_id,
-						       const char *query_string);
+						       const char *query_string, UINT64 version);
 int qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent, bool marker);
+extern int qfile_get_list_cache_entry_count (void);
+/* class modification versions used to validate cached results */
+extern UINT64 qfile_get_list_cache_clock (void);
+extern UINT64 qfile_get_list_cache_class_version (const OID * class_oid);
+extern void qfile_advance_list_cache_class_version (const OID * class_oid);
 
 /* Scan related routines */
 extern int qfile_modify_type_list (QFILE_TUPLE_VALUE_TYPE_LIST * type_list, QFILE_LIST_ID * list_id);
@@ -99,6 +99,9 @@ struct partition_cache_entry
   int count;			/* number of partitions */
 
   ATTR_ID attr_id;		/* attribute id of the partitioning key */
+
+  DB_VALUE *range_min;		/* RANGE only: lower bound of each partition, in ascending order */
+  DB_VALUE *range_max;		/* RANGE only: upper bound of each partition, in ascending order */
 };
 
 /* PRUNING_BITSET operations */
@@ -122,6 +125,8 @@ static int partition_cache_pruning_context (PRUNING_CONTEXT * pinfo, bool * alre
 static bool partition_load_context_from_cache (PRUNING_CONTEXT * pinfo, bool * is_modified);
 static int partition_cache_entry_to_pruning_context (PRUNING_CONTEXT * pinfo, PARTITION_CACHE_ENTRY * entry_p);
 static PARTITION_CACHE_ENTRY *partition_pruning_context_to_cache_entry (PRUNING_CONTEXT * pinfo);
+static void partition_cache_range_bounds (PARTITION_CACHE_ENTRY * entry_p);
+static void partition_free_range_bounds (PARTITION_CACHE_ENTRY * entry_p);
 static PRUNING_OP partition_rel_op_to_pruning_op (REL_OP op);
 static int partition_load_partition_predicate (PRUNING_CONTEXT * pinfo, OR_PARTITION * master);
 static void partition_free_partition_predicate (PRUNING_CONTEXT * pinfo);
@@ -165,6 +170,10 @@ static int partition_attrinfo_get_key (THREAD_ENTRY * thread_p, PRUNING_CONTEXT
 
 /* misc pruning functions */
 static bool partition_decrement_value (DB_VALUE * val);
+static int partition_range_search (const DB_VALUE * bounds, int count, bool is_max, const DB_VALUE * val,
+				   bool inclusive, bool decrement, int *pos_p);
+static int partition_prune_range_sorted (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, const PRUNING_OP op,
+					 PRUNING_BITSET * pruned, MATCH_STATUS * status_p);
 
 
 /* PRUNING_BITSET manipulation functions */
@@ -423,6 +432,8 @@ partition_free_cache_entry (PARTITION_CACHE_ENTRY * entry)
 	  free_and_init (entry->partitions);
 	}
 
+      partition_free_range_bounds (entry);
+
       free_and_init (entry);
     }
 
@@ -465,6 +476,9 @@ partition_cache_entry_to_pruning_context (PRUNING_CONTEXT * pinfo, PARTITION_CAC
 
   pinfo->partition_type = (DB_PARTITION_TYPE) pinfo->partitions[0].partition_type;
 
+  pinfo->range_min = entry_p->range_min;
+  pinfo->range_max = entry_p->range_max;
+
   return NO_ERROR;
 }
 
@@ -492,6 +506,8 @@ partition_pruning_context_to_cache_entry (PRUNING_CONTEXT * pinfo)
     }
   entry_p->partitions = NULL;
   entry_p->count = 0;
+  entry_p->range_min = NULL;
+  entry_p->range_max = NULL;
 
   COPY_OID (&entry_p->class_oid, &pinfo->root_oid);
   entry_p->attr_id = pinfo->attr_id;
@@ -531,6 +547,11 @@ partition_pruning_context_to_cache_entry (PRUNING_CONTEXT * pinfo)
 	}
     }
 
+  if (pinfo->partition_type == DB_PARTITION_RANGE)
+    {
+      partition_cache_range_bounds (entry_p);
+    }
+
   /* restore heap id */
   db_change_private_heap (pinfo->thread_p, old_heap_id);
 
@@ -565,6 +586,101 @@ error_return:
   return NULL;
 }
 
+/*
+ * partition_cache_range_bounds () - extract the bounds of RANGE partitions
+ *				     into the cache entry
+ * return : void
+ * entry_p (in/out) : cache entry
+ *
+ * Note: The bounds are extracted once per cache entry so that pruning does
+ *  not have to unpack the values sequence of every partition on each
+ *  execution. They are kept only if the upper bounds are strictly ascending
+ *  (MAXVALUE last), which allows partition_prune_range to binary search
+ *  them; otherwise the entry is left without bounds and pruning falls back to
+ *  the linear scan. Must be called with the private heap set to 0.
+ */
+static void
+partition_cache_range_bounds (PARTITION_CACHE_ENTRY * entry_p)
+{
+  int i, count;
+
+  assert (entry_p != NULL);
+
+  count = entry_p->count - 1;
+  if (count <= 0)
+    {
+      return;
+    }
+
+  entry_p->range_min = (DB_VALUE *) malloc (count * sizeof (DB_VALUE));
+  entry_p->range_max = (DB_VALUE *) malloc (count * sizeof (DB_VALUE));
+  if (entry_p->range_min == NULL || entry_p->range_max == NULL)
+    {
+      /* not an error, pruning can do without the sorted bounds */
+      partition_free_range_bounds (entry_p);
+      return;
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      db_make_null (&entry_p->range_min[i]);
+      db_make_null (&entry_p->range_max[i]);
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      if (entry_p->partitions[i + 1].values == NULL
+	  || db_set_get (entry_p->partitions[i + 1].values, 0, &entry_p->range_min[i]) != NO_ERROR
+	  || db_set_get (entry_p->partitions[i + 1].values, 1, &entry_p->range_max[i]) != NO_ERROR)
+	{
+	  er_clear ();
+	  partition_free_range_bounds (entry_p);
+	  return;
+	}
+
+      if (i > 0)
+	{
+	  /* only the last partition may have MAXVALUE and upper bounds must be strictly ascending */
+	  if (DB_IS_NULL (&entry_p->range_max[i - 1])
+	      || (!DB_IS_NULL (&entry_p->range_max[i])
+		  && tp_value_compare (&entry_p->range_max[i - 1], &entry_p->range_max[i], 1, 1) != DB_LT))
+	    {
+	      partition_free_range_bounds (entry_p);
+	      return;
+	    }
+	}
+    }
+}
+
+/*
+ * partition_free_range_bounds () - free the RANGE bounds of a cache entry
+ * return : void
+ * entry_p (in/out) : cache entry
+ */
+static void
+partition_free_range_bounds (PARTITION_CACHE_ENTRY * entry_p)
+{
+  int i;
+
+  if (entry_p->range_min != NULL && entry_p->range_max != NULL)
+    {
+      for (i = 0; i < entry_p->count - 1; i++)
+	{
+	  pr_clear_value (&entry_p->range_min[i]);
+	  pr_clear_value (&entry_p->range_max[i]);
+	}
+    }
+
+  if (entry_p->range_min != NULL)
+    {
+      free_and_init (entry_p->range_min);
+    }
+  if (entry_p->range_max != NULL)
+    {
+      free_and_init (entry_p->range_max);
+    }
+}
+
 /*
  * partition_cache_pruning_context () - cache a pruning context
  * return : error code or NO_ERROR
@@ -1285,15 +1401,22 @@ partition_prune_hash (PRUNING_CONTEXT * pinfo, const DB_VALUE * val_p, const PRU
 	    if (TP_DOMAIN_TYPE (col_domain) != DB_VALUE_TYPE (&col))
 	      {
 		/* A failed coercion is not an error in this case, we should just skip over it */
-		if (tp_value_cast (val_p, &val, col_domain, false) == DOMAIN_INCOMPATIBLE)
+		if (tp_value_cast (&col, &val, col_domain, false) == DOMAIN_INCOMPATIBLE)
 		  {
 		    pr_clear_value (&col);
+		    pr_clear_value (&val);
 		    er_clear ();
 		    continue;
 		  }
-	      }
 
-	    idx = mht_get_hash_number (hash_size, &col);
+		/* hash the coerced value, the same way PO_EQ does */
+		idx = mht_get_hash_number (hash_size, &val);
+		pr_clear_value (&val);
+	      }
+	    else
+	      {
+		idx = mht_get_hash_number (hash_size, &col);
+	      }
 	    pruningset_add (pruned, idx);
 
 	    pr_clear_value (&col);
@@ -1338,6 +1461,15 @@ partition_prune_range (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, const PRUN
   int rmin = DB_UNK, rmax = DB_UNK;
   MATCH_STATUS status;
 
+  if (pinfo->range_min != NULL && pinfo->range_max != NULL)
+    {
+      /* binary search the cached bounds; on incomparable values fall back to the linear scan below */
+      if (partition_prune_range_sorted (pinfo, val, op, pruned, &status) == NO_ERROR)
+	{
+	  return status;
+	}
+    }
+
   db_make_null (&min);
   db_make_null (&max);
 
@@ -1475,6 +1607,182 @@ cleanup:
   return status;
 }
 
+/*
+ * partition_range_search () - binary search sorted RANGE bounds
+ * return : error code or NO_ERROR
+ * bounds (in)	  : ascending bounds
+ * count (in)	  : number of bounds
+ * is_max (in)	  : true if bounds are upper bounds (NULL means MAXVALUE),
+ *		    false if they are lower bounds (NULL means MINVALUE)
+ * val (in)	  : searched value
+ * inclusive (in) : also stop on bounds equal to val
+ * decrement (in) : compare against bound-- (see PO_GT in
+ *		    partition_prune_range)
+ * pos_p (out)	  : first position for which val < bound (or val <= bound
+ *		    if inclusive), count if there is none
+ *
+ * Note: ER_FAILED is returned without setting an error if val cannot be
+ *  compared with a bound, the caller should fall back to the linear scan.
+ */
+static int
+partition_range_search (const DB_VALUE * bounds, int count, bool is_max, const DB_VALUE * val, bool inclusive,
+			bool decrement, int *pos_p)
+{
+  int low = 0, high = count, mid;
+  int cmp;
+  bool is_before;
+  DB_VALUE bound;
+
+  while (low < high)
+    {
+      mid = low + (high - low) / 2;
+
+      if (DB_IS_NULL (&bounds[mid]))
+	{
+	  /* MAXVALUE is after every value, MINVALUE is before every value */
+	  is_before = is_max;
+	}
+      else
+	{
+	  if (decrement)
+	    {
+	      if (pr_clone_value (&bounds[mid], &bound) != NO_ERROR)
+		{
+		  return ER_FAILED;
+		}
+	      (void) partition_decrement_value (&bound);
+	      cmp = tp_value_compare (val, &bound, 1, 1);
+	      pr_clear_value (&bound);
+	    }
+	  else
+	    {
+	      cmp = tp_value_compare (val, &bounds[mid], 1, 1);
+	    }
+
+	  if (cmp != DB_LT && cmp != DB_EQ && cmp != DB_GT)
+	    {
+	      return ER_FAILED;
+	    }
+	  is_before = (cmp == DB_LT || (inclusive && cmp == DB_EQ));
+	}
+
+      if (is_before)
+	{
+	  high = mid;
+	}
+      else
+	{
+	  low = mid + 1;
+	}
+    }
+
+  *pos_p = low;
+  return NO_ERROR;
+}
+
+/*
+ * partition_prune_range_sorted () - Perform pruning for RANGE type partitions
+ *				     using the cached sorted bounds
+ * return : NO_ERROR, or ER_FAILED if the linear scan has to be used instead
+ * pinfo (in)	   : pruning context
+ * val(in)	   : the value to which the partition expression is compared
+ * op (in)	   : operator to apply
+ * pruned (in/out) : pruned partitions
+ * status_p (out)  : match status
+ *
+ * Note: Partitions are contiguous intervals [min, max), so each operator
+ *  selects either one partition (PO_EQ, PO_IS_NULL), a prefix (PO_LT, PO_LE)
+ *  or a suffix (PO_GT, PO_GE) of the sorted partitions.
+ */
+static int
+partition_prune_range_sorted (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, const PRUNING_OP op,
+			      PRUNING_BITSET * pruned, MATCH_STATUS * status_p)
+{
+  int count = PARTITIONS_COUNT (pinfo);
+  int pos = 0, first = 0, last = 0, i, cmp;
+  int error = NO_ERROR;
+
+  assert (pinfo->range_min != NULL && pinfo->range_max != NULL);
+
+  switch (op)
+    {
+    case PO_EQ:
+      /* the only partition for which min <= value < max */
+      error = partition_range_search (pinfo->range_max, count, true, val, false, false, &pos);
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+      if (pos < count && !DB_IS_NULL (&pinfo->range_min[pos]))
+	{
+	  cmp = tp_value_compare (&pinfo->range_min[pos], val, 1, 1);
+	  if (cmp != DB_LT && cmp != DB_EQ && cmp != DB_GT)
+	    {
+	      error = ER_FAILED;
+	      break;
+	    }
+	  if (cmp == DB_GT)
+	    {
+	      pos = count;
+	    }
+	}
+      first = pos;
+      last = MIN (pos + 1, count);
+      break;
+
+    case PO_LT:
+      /* all partitions for which min < value */
+      error = partition_range_search (pinfo->range_min, count, false, val, true, false, &pos);
+      first = 0;
+      last = pos;
+      break;
+
+    case PO_LE:
+      /* all partitions for which min <= value */
+      error = partition_range_search (pinfo->range_min, count, false, val, false, false, &pos);
+      first = 0;
+      last = pos;
+      break;
+
+    case PO_GT:
+      /* all partitions for which value < max-- */
+      error = partition_range_search (pinfo->range_max, count, true, val, false, true, &pos);
+      first = pos;
+      last = count;
+      break;
+
+    case PO_GE:
+      /* all partitions for which value < max */
+      error = partition_range_search (pinfo->range_max, count, true, val, false, false, &pos);
+      first = pos;
+      last = count;
+      break;
+
+    case PO_IS_NULL:
+      /* the MINVALUE partition, if any */
+      first = 0;
+      last = DB_IS_NULL (&pinfo->range_min[0]) ? 1 : 0;
+      break;
+
+    default:
+      *status_p = MATCH_NOT_FOUND;
+      return NO_ERROR;
+    }
+
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  for (i = first; i < last; i++)
+    {
+      pruningset_add (pruned, i);
+    }
+
+  *status_p = (first < last) ? MATCH_OK : MATCH_NOT_FOUND;
+  return NO_ERROR;
+}
+
 /*
  * partition_prune_db_val () - prune partitions using the given DB_VALUE
  * return : match status
@@ -2177,6 +2485,8 @@ partition_init_pruning_context (PRUNING_CONTEXT * pinfo)
   pinfo->spec = NULL;
   pinfo->vd = NULL;
   pinfo->count = 0;
+  pinfo->range_min = NULL;
+  pinfo->range_max = NULL;
   pinfo->fp_cache_context = NULL;
   pinfo->partition_pred = NULL;
   pinfo->attr_position = -1;
@@ -2399,6 +2709,8 @@ partition_clear_pruning_context (PRUNING_CONTEXT * pinfo)
   pinfo->partitions = NULL;
   pinfo->selected_partition = NULL;
   pinfo->count = 0;
+  pinfo->range_min = NULL;
+  pinfo->range_max = NULL;
 
   partition_free_partition_predicate (pinfo);
 
@@ -79,6 +79,8 @@ struct pruning_context
 					 * holds the partition info */
   SCANCACHE_LIST *scan_cache_list;	/* caches for partitions affected by the query using this context */
   int count;			/* number of partitions */
+  const DB_VALUE *range_min;	/* cached sorted lower bounds of RANGE partitions (NULL if not available) */
+  const DB_VALUE *range_max;	/* cached sorted upper bounds of RANGE partitions (NULL if not available) */
 
   xasl_unpack_info *fp_cache_context;	/* unpacking info */
   func_pred *partition_pred;	/* partition predicate */
@@ -132,6 +132,30 @@ execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int var_cnt, const
   return ret;
 }
 
+/*
+ * execute_query_array () - Execute a prepared query once for each row of host variables
+ *   return: Number of rows executed successfully
+ *   xasl_id(in)        : XASL file id that was a result of prepare_query()
+ *   var_cnt(in)        : number of host variables of a row
+ *   row_cnt(in)        : number of rows
+ *   varptr(in) : array of host variables of the rows, row after row
+ *   flag(in)   : flag
+ *   row_counts(out)    : tuple count of each executed row
+ *
+ * Note: All the rows are executed by a single server request. The execution
+ *       stops at the first row that fails, and its error is set.
+ */
+int
+execute_query_array (const XASL_ID * xasl_id, int var_cnt, int row_cnt, const DB_VALUE * varptr, QUERY_FLAG flag,
+		     int *row_counts)
+{
+  int query_timeout;
+
+  query_timeout = tran_get_query_timeout ();
+  /* send XASL file id and host variables of all the rows to the server */
+  return qmgr_execute_query_array (xasl_id, var_cnt, row_cnt, varptr, flag, query_timeout, row_counts);
+}
+
 /*
  * prepare_and_execute_query () -
  *   return:
@@ -339,6 +339,19 @@ struct del_lob_info
 };
 
 /* used for internal update/delete execution */
+/* set of instance OIDs already processed by a multi-table UPDATE/DELETE; OIDs are kept in a private memory hash
+ * table and the set moves to a temporary extendible hash file once the table outgrows max_hash_list_scan_size */
+struct upddel_oid_set
+{
+  OID *slots;			/* open addressing table; a null OID marks an empty slot */
+  int capacity;			/* number of slots, a power of two */
+  int count;			/* number of OIDs in slots */
+  EHID ehid;			/* spill file */
+  bool is_spilled;		/* true if the set lives in ehid */
+};
+
+#define UPDDEL_OID_SET_INITIAL_CAPACITY 1024
+
 typedef struct upddel_class_info_internal UPDDEL_CLASS_INFO_INTERNAL;
 struct upddel_class_info_internal
 {
@@ -387,7 +400,9 @@ static int qexec_add_composite_lock (THREAD_ENTRY * thread_p, REGU_VARIABLE_LIST
 				     LK_COMPOSITE_LOCK * composite_lock, int upd_del_cls_cnt, OID * default_cls_oid);
 static QPROC_TPLDESCR_STATUS qexec_generate_tuple_descriptor (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id,
 							      VALPTR_LIST * outptr_list, VAL_DESCR * vd);
-static int qexec_upddel_add_unique_oid_to_ehid (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
+static int qexec_upddel_add_unique_oid (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
+static int qexec_upddel_oid_set_add (THREAD_ENTRY * thread_p, UPDDEL_OID_SET * oid_set, const OID * oid);
+static int qexec_upddel_oid_set_grow (THREAD_ENTRY * thread_p, UPDDEL_OID_SET * oid_set);
 static int qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				    QFILE_TUPLE_RECORD * tplrec);
 static void qexec_failure_line (int line, XASL_STATE * xasl_state);
@@ -520,8 +535,8 @@ static SCAN_CODE qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XA
 static SCAN_CODE qexec_merge_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				  QFILE_TUPLE_RECORD * tplrec, XASL_SCAN_FNC_PTR ignore);
 static int qexec_setup_list_id (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
-static int qexec_init_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist);
-static void qexec_destroy_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist);
+static int qexec_init_upddel_oid_sets (THREAD_ENTRY * thread_p, XASL_NODE * buildlist);
+static void qexec_destroy_upddel_oid_sets (THREAD_ENTRY * thread_p, XASL_NODE * buildlist);
 static int qexec_execute_update (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool has_delete, XASL_STATE * xasl_state);
 static int qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 static int qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, bool skip_aptr);
@@ -968,17 +983,17 @@ exit_on_error:
 }
 
 /*
- * qexec_upddel_add_unique_oid_to_ehid () -
+ * qexec_upddel_add_unique_oid () -
  *   return: error code (<0) or the number of removed OIDs (>=0).
  *   thread_p(in) :
  *   xasl(in) : The XASL node of the generated SELECT statement for UPDATE or
- *		DELETE. It must be a BUILDLIST_PROC and have the temporary hash
- *		files already created (upddel_oid_locator_ehids).
+ *		DELETE. It must be a BUILDLIST_PROC and have the OID sets
+ *		already created (upddel_oid_sets).
  *   xasl_state(in) :
  *
  *  Note: This function is used only for the SELECT queries generated for UPDATE
  *	  or DELETE statements. It sets each instance OID from the outptr_list
- *	  to null if the OID already exists in the hash file associated with the
+ *	  to null if the OID already exists in the OID set associated with the
  *	  source table of the OID. (It eliminates duplicate OIDs in order to not
  *	  UPDATE/DELETE them more than once). The function returns the number of
  *	  removed OIDs so that the caller can remove the entire row from
@@ -986,17 +1001,15 @@ exit_on_error:
  *	  null instance OIDs will be skipped from UPDATE/DELETE processing.
  */
 static int
-qexec_upddel_add_unique_oid_to_ehid (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+qexec_upddel_add_unique_oid (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
 {
   REGU_VARIABLE_LIST reg_var_list = NULL;
   DB_VALUE *dbval = NULL, *orig_dbval = NULL, element;
   DB_TYPE typ;
   int ret = NO_ERROR, idx, rem_cnt = 0;
-  EHID *ehid = NULL;
-  OID oid, key_oid;
-  EH_SEARCH eh_search;
+  OID key_oid;
 
-  if (xasl == NULL || xasl->type != BUILDLIST_PROC || xasl->proc.buildlist.upddel_oid_locator_ehids == NULL)
+  if (xasl == NULL || xasl->type != BUILDLIST_PROC || xasl->proc.buildlist.upddel_oid_sets == NULL)
     {
       return NO_ERROR;
     }
@@ -1034,30 +1047,21 @@ qexec_upddel_add_unique_oid_to_ehid (THREAD_ENTRY * thread_p, XASL_NODE * xasl,
 	      GOTO_EXIT_ON_ERROR;
 	    }
 
-	  /* Get the appropriate hash file and check if the OID exists in the file */
-	  ehid = &xasl->proc.buildlist.upddel_oid_locator_ehids[idx];
-
+	  /* Check the OID against the set of the appropriate class and add it if it is new */
 	  SAFE_COPY_OID (&key_oid, db_get_oid (dbval));
 
-	  eh_search = ehash_search (thread_p, ehid, &key_oid, &oid);
-	  switch (eh_search)
+	  ret = qexec_upddel_oid_set_add (thread_p, &xasl->proc.buildlist.upddel_oid_sets[idx], &key_oid);
+	  if (ret < 0)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  if (ret > 0)
 	    {
-	    case EH_KEY_FOUND:
 	      /* Make it null because it was already processed */
 	      pr_clear_value (orig_dbval);
 	      rem_cnt++;
-	      break;
-	    case EH_KEY_NOTFOUND:
-	      /* The OID was not processed so insert it in the hash file */
-	      if (ehash_insert (thread_p, ehid, &key_oid, &key_oid) == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	      break;
-	    case EH_ERROR_OCCURRED:
-	    default:
-	      GOTO_EXIT_ON_ERROR;
 	    }
+	  ret = NO_ERROR;
 	}
       else
 	{
@@ -1090,6 +1094,148 @@ exit_on_error:
   return ret;
 }
 
+/*
+ * qexec_upddel_oid_set_add () - add an OID to a duplicate elimination set
+ *   return: error code (<0), 1 if the OID was already in the set, 0 if it was added
+ *   thread_p(in) :
+ *   oid_set(in/out) :
+ *   oid(in) : instance OID
+ */
+static int
+qexec_upddel_oid_set_add (THREAD_ENTRY * thread_p, UPDDEL_OID_SET * oid_set, const OID * oid)
+{
+  OID found_oid;
+  unsigned int mask, pos;
+  int error;
+
+  if (!oid_set->is_spilled && (oid_set->count + 1) * 2 > oid_set->capacity)
+    {
+      /* keep the load factor under one half */
+      error = qexec_upddel_oid_set_grow (thread_p, oid_set);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  if (oid_set->is_spilled)
+    {
+      switch (ehash_search (thread_p, &oid_set->ehid, (void *) oid, &found_oid))
+	{
+	case EH_KEY_FOUND:
+	  return 1;
+	case EH_KEY_NOTFOUND:
+	  if (ehash_insert (thread_p, &oid_set->ehid, (void *) oid, (OID *) oid) == NULL)
+	    {
+	      ASSERT_ERROR_AND_SET (error);
+	      return error;
+	    }
+	  return 0;
+	case EH_ERROR_OCCURRED:
+	default:
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
+	}
+    }
+
+  mask = (unsigned int) oid_set->capacity - 1;
+  for (pos = OID_PSEUDO_KEY (oid) & mask; !OID_ISNULL (&oid_set->slots[pos]); pos = (pos + 1) & mask)
+    {
+      if (OID_EQ (&oid_set->slots[pos], oid))
+	{
+	  return 1;
+	}
+    }
+
+  COPY_OID (&oid_set->slots[pos], oid);
+  oid_set->count++;
+
+  return 0;
+}
+
+/*
+ * qexec_upddel_oid_set_grow () - double the hash table of an OID set or move the set to a temporary extendible hash
+ *				  file if the larger table would exceed the memory budget
+ *   return: error code
+ *   thread_p(in) :
+ *   oid_set(in/out) :
+ */
+static int
+qexec_upddel_oid_set_grow (THREAD_ENTRY * thread_p, UPDDEL_OID_SET * oid_set)
+{
+  OID *old_slots = oid_set->slots;
+  int old_capacity = oid_set->capacity;
+  int new_capacity, i;
+  unsigned int mask, pos;
+  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE);
+
+  new_capacity = (old_capacity == 0) ? UPDDEL_OID_SET_INITIAL_CAPACITY : old_capacity * 2;
+
+  if ((UINT64) new_capacity * sizeof (OID) > mem_limit)
+    {
+      oid_set->ehid.vfid.volid = LOG_DBFIRST_VOLID;
+      if (xehash_create (thread_p, &oid_set->ehid, DB_TYPE_OBJECT, -1, NULL, 0, true) == NULL)
+	{
+	  return ER_FAILED;
+	}
+      oid_set->is_spilled = true;
+
+      for (i = 0; i < old_capacity; i++)
+	{
+	  if (OID_ISNULL (&old_slots[i]))
+	    {
+	      continue;
+	    }
+	  if (ehash_insert (thread_p, &oid_set->ehid, &old_slots[i], &old_slots[i]) == NULL)
+	    {
+	      return ER_FAILED;
+	    }
+	}
+
+      if (old_slots != NULL)
+	{
+	  db_private_free_and_init (thread_p, oid_set->slots);
+	}
+      oid_set->capacity = 0;
+      oid_set->count = 0;
+
+      return NO_ERROR;
+    }
+
+  oid_set->slots = (OID *) db_private_alloc (thread_p, new_capacity * sizeof (OID));
+  if (oid_set->slots == NULL)
+    {
+      oid_set->slots = old_slots;
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  for (i = 0; i < new_capacity; i++)
+    {
+      OID_SET_NULL (&oid_set->slots[i]);
+    }
+  oid_set->capacity = new_capacity;
+
+  mask = (unsigned int) new_capacity - 1;
+  for (i = 0; i < old_capacity; i++)
+    {
+      if (OID_ISNULL (&old_slots[i]))
+	{
+	  continue;
+	}
+      for (pos = OID_PSEUDO_KEY (&old_slots[i]) & mask; !OID_ISNULL (&oid_set->slots[pos]); pos = (pos + 1) & mask)
+	{
+	  ;
+	}
+      COPY_OID (&oid_set->slots[pos], &old_slots[i]);
+    }
+
+  if (old_slots != NULL)
+    {
+      db_private_free (thread_p, old_slots);
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * qexec_end_one_iteration () -
  *   return: NO_ERROR or ER_code
@@ -1112,7 +1258,7 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
       && !XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG))
     {
       /* Remove OIDs already processed */
-      ret = qexec_upddel_add_unique_oid_to_ehid (thread_p, xasl, xasl_state);
+      ret = qexec_upddel_add_unique_oid (thread_p, xasl, xasl_state);
       if (ret < 0)
 	{
 	  GOTO_EXIT_ON_ERROR;
@@ -2365,9 +2511,9 @@ qexec_clear_xasl (THREAD_ENTRY * thread_p, xasl_node * xasl, bool is_final)
 	    scan_end_scan (thread_p, &xasl->merge_spec->s_id);
 	    scan_close_scan (thread_p, &xasl->merge_spec->s_id);
 	  }
-	if (buildlist->upddel_oid_locator_ehids != NULL)
+	if (buildlist->upddel_oid_sets != NULL)
 	  {
-	    qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	    qexec_destroy_upddel_oid_sets (thread_p, xasl);
 	  }
 	if (is_final)
 	  {
@@ -8415,61 +8561,51 @@ qexec_setup_list_id (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
 }
 
 /*
- * qexec_init_upddel_ehash_files () - Initializes the hash files used for
- *				       duplicate OIDs elimination.
+ * qexec_init_upddel_oid_sets () - Initializes the OID sets used for
+ *				    duplicate OIDs elimination.
  *   return: NO_ERROR, or ER_code
  *   thread_p(in):
  *   buildlist(in): BUILDLIST_PROC XASL
  *
  * Note: The function is used only for SELECT statement generated for
  *	 UPDATE/DELETE. The case of SINGLE-UPDATE/SINGLE-DELETE is skipped.
+ *	 The hash tables are allocated on first insert.
  */
 static int
-qexec_init_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
+qexec_init_upddel_oid_sets (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
 {
   int idx;
-  EHID *hash_list = NULL;
+  UPDDEL_OID_SET *oid_sets = NULL;
 
   if (buildlist == NULL || buildlist->type != BUILDLIST_PROC)
     {
       return NO_ERROR;
     }
 
-  hash_list = (EHID *) db_private_alloc (thread_p, buildlist->upd_del_class_cnt * sizeof (EHID));
-  if (hash_list == NULL)
+  oid_sets = (UPDDEL_OID_SET *) db_private_alloc (thread_p, buildlist->upd_del_class_cnt * sizeof (UPDDEL_OID_SET));
+  if (oid_sets == NULL)
     {
-      goto exit_on_error;
+      return ER_FAILED;
     }
 
   for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
     {
-      hash_list[idx].vfid.volid = LOG_DBFIRST_VOLID;
-      if (xehash_create (thread_p, &hash_list[idx], DB_TYPE_OBJECT, -1, NULL, 0, true) == NULL)
-	{
-	  goto exit_on_error;
-	}
+      oid_sets[idx].slots = NULL;
+      oid_sets[idx].capacity = 0;
+      oid_sets[idx].count = 0;
+      VFID_SET_NULL (&oid_sets[idx].ehid.vfid);
+      oid_sets[idx].ehid.pageid = NULL_PAGEID;
+      oid_sets[idx].is_spilled = false;
     }
-  buildlist->proc.buildlist.upddel_oid_locator_ehids = hash_list;
+  buildlist->proc.buildlist.upddel_oid_sets = oid_sets;
 
   return NO_ERROR;
-
-exit_on_error:
-  if (hash_list != NULL)
-    {
-      for (--idx; idx >= 0; idx--)
-	{
-	  xehash_destroy (thread_p, &hash_list[idx]);
-	}
-      db_private_free (thread_p, hash_list);
-    }
-
-  return ER_FAILED;
 }
 
 /*
- * qexec_destroy_upddel_ehash_files () - Destroys the hash files used for
- *					 duplicate rows elimination in
- *					 UPDATE/DELETE.
+ * qexec_destroy_upddel_oid_sets () - Destroys the OID sets used for
+ *				       duplicate rows elimination in
+ *				       UPDATE/DELETE.
  *   return: void
  *   thread_p(in):
  *   buildlist(in): BUILDLIST_PROC XASL
@@ -8478,24 +8614,28 @@ exit_on_error:
  *	 UPDATE/DELETE.
  */
 static void
-qexec_destroy_upddel_ehash_files (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
+qexec_destroy_upddel_oid_sets (THREAD_ENTRY * thread_p, XASL_NODE * buildlist)
 {
   int idx;
   bool save_interrupted;
-  EHID *hash_list = buildlist->proc.buildlist.upddel_oid_locator_ehids;
+  UPDDEL_OID_SET *oid_sets = buildlist->proc.buildlist.upddel_oid_sets;
 
   save_interrupted = logtb_set_check_interrupt (thread_p, false);
 
   for (idx = 0; idx < buildlist->upd_del_class_cnt; idx++)
     {
-      if (xehash_destroy (thread_p, &hash_list[idx]) != NO_ERROR)
+      if (oid_sets[idx].is_spilled && xehash_destroy (thread_p, &oid_sets[idx].ehid) != NO_ERROR)
 	{
 	  /* should not fail or we'll leak reserved sectors */
 	  assert (false);
 	}
+      if (oid_sets[idx].slots != NULL)
+	{
+	  db_private_free_and_init (thread_p, oid_sets[idx].slots);
+	}
     }
-  db_private_free (thread_p, hash_list);
-  buildlist->proc.buildlist.upddel_oid_locator_ehids = NULL;
+  db_private_free (thread_p, oid_sets);
+  buildlist->proc.buildlist.upddel_oid_sets = NULL;
 
   (void) logtb_set_check_interrupt (thread_p, save_interrupted);
 }
@@ -12952,17 +13092,17 @@ qexec_start_mainblock_iterations (THREAD_ENTRY * thread_p, xasl_node * xasl, xas
       {
 	BUILDLIST_PROC_NODE *buildlist = &xasl->proc.buildlist;
 
-	/* Initialize extendible hash files for SELECT statement generated for multi UPDATE/DELETE */
+	/* Initialize OID sets for SELECT statement generated for multi UPDATE/DELETE */
 	if (QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl) && !XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG))
 	  {
-	    if (qexec_init_upddel_ehash_files (thread_p, xasl) != NO_ERROR)
+	    if (qexec_init_upddel_oid_sets (thread_p, xasl) != NO_ERROR)
 	      {
 		GOTO_EXIT_ON_ERROR;
 	      }
 	  }
 	else
 	  {
-	    buildlist->upddel_oid_locator_ehids = NULL;
+	    buildlist->upddel_oid_sets = NULL;
 	  }
 
 	/* initialize groupby_num() value for BUILDLIST_PROC */
@@ -13145,9 +13285,9 @@ exit_on_error:
 
   if (xasl->type == BUILDLIST_PROC)
     {
-      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
+      if (xasl->proc.buildlist.upddel_oid_sets != NULL)
 	{
-	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	  qexec_destroy_upddel_oid_sets (thread_p, xasl);
 	}
     }
   return ER_FAILED;
@@ -13341,10 +13481,10 @@ qexec_end_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_
     {
 
     case BUILDLIST_PROC:	/* end BUILDLIST_PROC iterations */
-      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
-      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
+      /* Destroy the OID sets, and their spilled hash files, of the SELECT generated for UPDATE/DELETE */
+      if (xasl->proc.buildlist.upddel_oid_sets != NULL)
 	{
-	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	  qexec_destroy_upddel_oid_sets (thread_p, xasl);
 	}
       /* fall through */
     case CONNECTBY_PROC:
@@ -13454,10 +13594,10 @@ qexec_clear_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
   switch (xasl->type)
     {
     case BUILDLIST_PROC:
-      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
-      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
+      /* Destroy the OID sets, and their spilled hash files, of the SELECT generated for UPDATE/DELETE */
+      if (xasl->proc.buildlist.upddel_oid_sets != NULL)
 	{
-	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	  qexec_destroy_upddel_oid_sets (thread_p, xasl);
 	}
       /* fall through */
     case CONNECTBY_PROC:
@@ -14973,30 +15113,14 @@ tranid_compare (const void *t1, const void *t2)
  *                                   by class OID
  *   return: NO_ERROR, or ER_code
  *   class_oid(in)      :
+ *
+ * Note: The entries are not flushed; the class gets a new modification version
+ *       and the cached results that depend on it are found stale at lookup.
  */
 int
 qexec_clear_list_cache_by_class (THREAD_ENTRY * thread_p, const OID * class_oid)
 {
-#if 0
-  /* TODO: Update this in xasl_cache.c */
-  XASL_CACHE_ENTRY *ent;
-  void *last;
-
-  /* for all entries in the class oid hash table Note that mht_put2() allows mutiple data with the same key, so we have
-   * to use mht_get2() */
-
-  last = NULL;
-  do
-    {
-      /* look up the hash table with the key */
-      ent = (XASL_CACHE_ENTRY *) mht_get2 (xasl_ent_cache.oid_ht, class_oid, &last);
-      if (ent && ent->list_ht_no >= 0)
-	{
-	  (void) qfile_clear_list_cache (thread_p, ent->list_ht_no, false);
-	}
-    }
-  while (ent);
-#endif /* 0 */
+  qfile_advance_list_cache_class_version (class_oid);
 
   return NO_ERROR;
 }
@@ -47,6 +47,7 @@
 #include "thread_entry.hpp"
 #include "xasl_cache.h"
 #include "xasl_unpack_info.hpp"
+#include "partition_sr.h"
 
 #if !defined (SERVER_MODE)
 
@@ -105,6 +106,8 @@ struct qmgr_tran_entry
   QMGR_QUERY_ENTRY *free_query_entry_list_p;	/* free query entry list */
 
   OID_BLOCK_LIST *modified_classes_p;	/* array of class OIDs */
+
+  int membuf_ext_pages;		/* memory pages of temp files extensions charged to transaction */
 };
 
 typedef struct qmgr_temp_file_list QMGR_TEMP_FILE_LIST;
@@ -130,10 +133,12 @@ struct qmgr_query_table
 
   /* temp file free list info */
   QMGR_TEMP_FILE_LIST temp_file_list[QMGR_NUM_TEMP_FILE_LISTS];
+
+  int membuf_ext_pages;		/* memory pages of all temp files extensions */
 };
 
 QMGR_QUERY_TABLE qmgr_Query_table = { NULL, 0, NULL,
-  {{PTHREAD_MUTEX_INITIALIZER, NULL, 0}, {PTHREAD_MUTEX_INITIALIZER, NULL, 0}}
+  {{PTHREAD_MUTEX_INITIALIZER, NULL, 0}, {PTHREAD_MUTEX_INITIALIZER, NULL, 0}}, 0
 };
 
 #if !defined(SERVER_MODE)
@@ -154,6 +159,11 @@ static void qmgr_delete_query_entry (THREAD_ENTRY * thread_p, QUERY_ID query_id,
 static void qmgr_free_tran_entries (THREAD_ENTRY * thread_p);
 
 static void qmgr_clear_relative_cache_entries (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry_p);
+static bool qmgr_add_modified_class_internal (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry_p,
+					      const OID * class_oid_p);
+static bool qmgr_is_related_class_modified (QMGR_TRAN_ENTRY * tran_entry_p,
+					    const XASL_CACHE_ENTRY * xasl_cache_entry_p);
+static UINT64 qmgr_get_list_cache_min_version (const XASL_CACHE_ENTRY * xasl_cache_entry_p);
 static OID_BLOCK_LIST *qmgr_allocate_oid_block (THREAD_ENTRY * thread_p);
 static void qmgr_free_oid_block (THREAD_ENTRY * thread_p, OID_BLOCK_LIST * oid_block);
 static int qmgr_init_external_file_page (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
@@ -161,6 +171,8 @@ static PAGE_PTR qmgr_get_external_file_page (THREAD_ENTRY * thread_p, VPID * vpi
 static int qmgr_free_query_temp_file_helper (THREAD_ENTRY * thread_p, QMGR_QUERY_ENTRY * query_p);
 static int qmgr_free_query_temp_file (THREAD_ENTRY * thread_p, QMGR_QUERY_ENTRY * qptr, int tran_idx);
 static QMGR_TEMP_FILE *qmgr_allocate_tempfile_with_buffer (int num_buffer_pages);
+static PAGE_PTR qmgr_extend_membuf (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfile_vfid_p);
+static void qmgr_free_membuf_ext (QMGR_TEMP_FILE * tfile_vfid_p);
 
 #if defined (SERVER_MODE)
 static XASL_NODE *qmgr_find_leaf (XASL_NODE * xasl);
@@ -191,14 +203,33 @@ static QMGR_PAGE_TYPE
 qmgr_get_page_type (PAGE_PTR page_p, QMGR_TEMP_FILE * temp_file_p)
 {
   PAGE_PTR begin_page = NULL, end_page = NULL;
+  int i;
+
+  if (temp_file_p != NULL && temp_file_p->membuf_last >= 0 && temp_file_p->membuf)
+    {
+      if (temp_file_p->membuf_npages > 0 && page_p >= temp_file_p->membuf[0]
+	  && page_p <= temp_file_p->membuf[MIN (temp_file_p->membuf_last, temp_file_p->membuf_npages - 1)])
+	{
+	  return QMGR_MEMBUF_PAGE;
+	}
+
+      for (i = 0; i < temp_file_p->membuf_ext_nchunks; i++)
+	{
+	  if (page_p >= temp_file_p->membuf_ext_chunks[i]
+	      && page_p < temp_file_p->membuf_ext_chunks[i] + temp_file_p->membuf_ext_chunk_npages[i] * DB_PAGESIZE)
+	    {
+	      return QMGR_MEMBUF_PAGE;
+	    }
+	}
+    }
 
-  if (temp_file_p != NULL && temp_file_p->membuf_last >= 0 && temp_file_p->membuf && page_p >= temp_file_p->membuf[0]
-      && page_p <= temp_file_p->membuf[temp_file_p->membuf_last])
+  if (temp_file_p == NULL || temp_file_p->membuf == NULL)
     {
-      return QMGR_MEMBUF_PAGE;
+      return QMGR_TEMP_FILE_PAGE;
     }
 
-  begin_page = (PAGE_PTR) ((PAGE_PTR) temp_file_p->membuf
+  /* membuf pages are allocated after the temp file structure and the membuf pointers */
+  begin_page = (PAGE_PTR) ((PAGE_PTR) temp_file_p + DB_ALIGN (sizeof (QMGR_TEMP_FILE), MAX_ALIGNMENT)
 			   + DB_ALIGN (sizeof (PAGE_PTR) * temp_file_p->membuf_npages, MAX_ALIGNMENT));
   end_page = begin_page + temp_file_p->membuf_npages * DB_PAGESIZE;
   if (begin_page <= page_p && page_p <= end_page)
@@ -603,6 +634,7 @@ qmgr_initialize_tran_entry (QMGR_TRAN_ENTRY * tran_entry_p)
   tran_entry_p->query_entry_list_p = NULL;
   tran_entry_p->free_query_entry_list_p = NULL;
   tran_entry_p->modified_classes_p = NULL;
+  tran_entry_p->membuf_ext_pages = 0;
 }
 
 /*
@@ -1240,7 +1272,9 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
   int tran_index = -1;
   QMGR_TRAN_ENTRY *tran_entry_p;
   QFILE_LIST_ID *list_id_p, *tmp_list_id_p;
+  UINT64 list_cache_version;
   bool cached_result;
+  bool is_related_class_modified;
   bool saved_is_stats_on;
   bool xasl_trace;
   bool is_xasl_pinned_reference;
@@ -1362,10 +1396,18 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
       goto exit_on_error;
     }
 
-  if (qmgr_can_get_result_from_cache (*flag_p))
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+
+  /* the cached results cannot see the uncommitted changes of this transaction */
+  is_related_class_modified = qmgr_is_related_class_modified (tran_entry_p, xasl_cache_entry_p);
+
+  if (qmgr_can_get_result_from_cache (*flag_p) && !is_related_class_modified)
     {
-      /* lookup the list cache with the parameter values (DB_VALUE array) */
-      list_cache_entry_p = qfile_lookup_list_cache_entry (thread_p, xasl_cache_entry_p->list_ht_no, &params);
+      /* lookup the list cache with the parameter values (DB_VALUE array); results made before the last modification
+       * of a related class are stale */
+      list_cache_entry_p =
+	qfile_lookup_list_cache_entry (thread_p, xasl_cache_entry_p->list_ht_no, &params,
+				       qmgr_get_list_cache_min_version (xasl_cache_entry_p));
       /* If we've got the cached result, return it. */
       if (list_cache_entry_p)
 	{
@@ -1387,8 +1429,6 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 
   /* Make an query entry */
   /* mark that this transaction is running a query */
-  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
-
 #if defined(ENABLE_SYSTEMTAP)
   if (tran_entry_p->trans_stat == QMGR_TRAN_NULL || tran_entry_p->trans_stat == QMGR_TRAN_TERMINATED)
     {
@@ -1468,6 +1508,9 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 
   assert (cached_result == false);
 
+  /* the result will reflect every class modification done before now */
+  list_cache_version = qfile_get_list_cache_clock ();
+
   list_id_p =
     qmgr_process_query (thread_p, xclone.xasl, NULL, 0, dbval_count, dbvals_p, *flag_p, query_p, tran_entry_p);
   if (list_id_p == NULL)
@@ -1481,7 +1524,7 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
   /* If it is allowed to cache the query result or if it is required to cache, put the list file id(QFILE_LIST_ID) into
    * the list cache. Provided are the corresponding XASL cache entry to be linked, and the parameters (host variables -
    * DB_VALUES). */
-  if (qmgr_is_allowed_result_cache (*flag_p))
+  if (qmgr_is_allowed_result_cache (*flag_p) && !is_related_class_modified)
     {
       /* check once more to ensure that the related XASL entry is still valid */
       if (xcache_can_entry_cache_list (xasl_cache_entry_p))
@@ -1517,7 +1560,7 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 	   * is, or make new one */
 	  list_cache_entry_p =
 	    qfile_update_list_cache_entry (thread_p, &xasl_cache_entry_p->list_ht_no, &params, list_id_p,
-					   xasl_cache_entry_p->sql_info.sql_hash_text);
+					   xasl_cache_entry_p->sql_info.sql_hash_text, list_cache_version);
 	  if (list_cache_entry_p == NULL)
 	    {
 	      char *s;
@@ -2025,6 +2068,59 @@ qmgr_clear_relative_cache_entries (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tr
     }
 }
 
+/*
+ * qmgr_is_related_class_modified () - Check whether the transaction modified a class the query depends on
+ *   return: true if one of the related classes of the XASL cache entry is modified by the transaction
+ *   tran_entry_p(in)   :
+ *   xasl_cache_entry_p(in)     :
+ */
+static bool
+qmgr_is_related_class_modified (QMGR_TRAN_ENTRY * tran_entry_p, const XASL_CACHE_ENTRY * xasl_cache_entry_p)
+{
+  OID_BLOCK_LIST *oid_block_p;
+  OID *class_oid_p;
+  int i, j;
+
+  for (oid_block_p = tran_entry_p->modified_classes_p; oid_block_p; oid_block_p = oid_block_p->next)
+    {
+      for (i = 0, class_oid_p = oid_block_p->oid_array; i < oid_block_p->last_oid_idx; i++, class_oid_p++)
+	{
+	  for (j = 0; j < xasl_cache_entry_p->n_related_objects; j++)
+	    {
+	      if (OID_EQ (class_oid_p, &xasl_cache_entry_p->related_objects[j].oid))
+		{
+		  return true;
+		}
+	    }
+	}
+    }
+
+  return false;
+}
+
+/*
+ * qmgr_get_list_cache_min_version () - Get the version a cached result of the query must have to be valid
+ *   return: newest modification version of the related classes
+ *   xasl_cache_entry_p(in)     :
+ */
+static UINT64
+qmgr_get_list_cache_min_version (const XASL_CACHE_ENTRY * xasl_cache_entry_p)
+{
+  UINT64 version, min_version = 0;
+  int i;
+
+  for (i = 0; i < xasl_cache_entry_p->n_related_objects; i++)
+    {
+      version = qfile_get_list_cache_class_version (&xasl_cache_entry_p->related_objects[i].oid);
+      if (version > min_version)
+	{
+	  min_version = version;
+	}
+    }
+
+  return min_version;
+}
+
 /*
  * qmgr_clear_trans_wakeup () -
  *   return:
@@ -2071,8 +2167,9 @@ qmgr_clear_trans_wakeup (THREAD_ENTRY * thread_p, int tran_index, bool is_tran_d
       qfile_clear_uncommited_list_cache_entry (thread_p, tran_index);
     }
 
-  /* if the transaction is aborting, clear relative cache entries */
-  if (tran_entry_p->modified_classes_p)
+  /* if the transaction is aborting, clear relative cache entries; a committing transaction keeps its modified classes
+   * until its changes are visible to others (see qmgr_clear_modified_classes) */
+  if (tran_entry_p->modified_classes_p && (is_abort || is_tran_died))
     {
       if (is_abort)
 	{
@@ -2256,30 +2353,59 @@ qmgr_free_oid_block (THREAD_ENTRY * thread_p, OID_BLOCK_LIST * oid_block_p)
 }
 
 /*
- * qmgr_add_modified_class () -
+ * qmgr_clear_modified_classes () - Clear the cache entries relative to the classes modified by a committed transaction
  *   return:
- *   class_oid(in)      :
+ *   tran_index(in)     : Log Transaction index
+ *
+ * Note: It must be called after the changes of the transaction are made
+ *       visible to new snapshots; a result computed in between would
+ *       otherwise be cached as up to date.
  */
 void
-qmgr_add_modified_class (THREAD_ENTRY * thread_p, const OID * class_oid_p)
+qmgr_clear_modified_classes (THREAD_ENTRY * thread_p, int tran_index)
 {
-  int tran_index;
   QMGR_TRAN_ENTRY *tran_entry_p;
+
+  if (tran_index >= qmgr_Query_table.num_trans
+#if defined (SERVER_MODE)
+      || tran_index == LOG_SYSTEM_TRAN_INDEX
+#endif
+    )
+    {
+      return;
+    }
+
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+  if (tran_entry_p->modified_classes_p == NULL)
+    {
+      return;
+    }
+
+  qmgr_clear_relative_cache_entries (thread_p, tran_entry_p);
+
+  qmgr_free_oid_block (thread_p, tran_entry_p->modified_classes_p);
+  tran_entry_p->modified_classes_p = NULL;
+}
+
+/*
+ * qmgr_add_modified_class_internal () - Add the class to the modified classes of the transaction
+ *   return: true if the class was added, false if it was already there or on error
+ *   tran_entry_p(in)   :
+ *   class_oid(in)      :
+ */
+static bool
+qmgr_add_modified_class_internal (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry_p, const OID * class_oid_p)
+{
   OID_BLOCK_LIST *oid_block_p, *tmp_oid_block_p;
   OID *tmp_oid_p;
   int i;
-  bool found;
-
-  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
 
   if (tran_entry_p->modified_classes_p == NULL
       && (tran_entry_p->modified_classes_p = qmgr_allocate_oid_block (thread_p)) == NULL)
     {
-      return;
+      return false;
     }
 
-  found = false;
   tmp_oid_block_p = tran_entry_p->modified_classes_p;
   do
     {
@@ -2288,25 +2414,63 @@ qmgr_add_modified_class (THREAD_ENTRY * thread_p, const OID * class_oid_p)
 	{
 	  if (oid_compare (class_oid_p, tmp_oid_p) == 0)
 	    {
-	      found = true;
-	      break;
+	      return false;
 	    }
 	}
       tmp_oid_block_p = oid_block_p->next;
     }
   while (tmp_oid_block_p);
 
-  if (!found)
+  if (oid_block_p->last_oid_idx < OID_BLOCK_ARRAY_SIZE)
     {
-      if (oid_block_p->last_oid_idx < OID_BLOCK_ARRAY_SIZE)
-	{
-	  oid_block_p->oid_array[oid_block_p->last_oid_idx++] = *class_oid_p;
-	}
-      else if ((oid_block_p->next = qmgr_allocate_oid_block (thread_p)) != NULL)
-	{
-	  oid_block_p = oid_block_p->next;
-	  oid_block_p->oid_array[oid_block_p->last_oid_idx++] = *class_oid_p;
-	}
+      oid_block_p->oid_array[oid_block_p->last_oid_idx++] = *class_oid_p;
+    }
+  else if ((oid_block_p->next = qmgr_allocate_oid_block (thread_p)) != NULL)
+    {
+      oid_block_p = oid_block_p->next;
+      oid_block_p->oid_array[oid_block_p->last_oid_idx++] = *class_oid_p;
+    }
+  else
+    {
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * qmgr_add_modified_class () -
+ *   return:
+ *   class_oid(in)      :
+ *
+ * Note: Queries on a partitioned class depend on the partitioned class
+ *       rather than on the partition actually modified, so the root class
+ *       is recorded as well the first time a class is modified.
+ */
+void
+qmgr_add_modified_class (THREAD_ENTRY * thread_p, const OID * class_oid_p)
+{
+  int tran_index;
+  QMGR_TRAN_ENTRY *tran_entry_p;
+  OID root_oid;
+
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+
+  if (!qmgr_add_modified_class_internal (thread_p, tran_entry_p, class_oid_p))
+    {
+      return;
+    }
+
+  if (partition_find_root_class_oid (thread_p, class_oid_p, &root_oid) != NO_ERROR)
+    {
+      er_clear ();
+      return;
+    }
+
+  if (!OID_ISNULL (&root_oid) && !OID_EQ (&root_oid, class_oid_p))
+    {
+      (void) qmgr_add_modified_class_internal (thread_p, tran_entry_p, &root_oid);
     }
 }
 
@@ -2479,6 +2643,16 @@ qmgr_get_new_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
       return tfile_vfid_p->membuf[tfile_vfid_p->membuf_last];
     }
 
+  if (tfile_vfid_p->membuf != NULL && VFID_ISNULL (&tfile_vfid_p->temp_vfid))
+    {
+      /* try to keep growing in memory while within the memory budget */
+      page_p = qmgr_extend_membuf (thread_p, vpid_p, tfile_vfid_p);
+      if (page_p != NULL)
+	{
+	  return page_p;
+	}
+    }
+
   /* memory buffer is exhausted; create temp file */
   if (VFID_ISNULL (&tfile_vfid_p->temp_vfid))
     {
@@ -2488,6 +2662,7 @@ qmgr_get_new_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
 	  return NULL;
 	}
       tfile_vfid_p->temp_file_type = FILE_TEMP;
+      perfmon_inc_stat (thread_p, PSTAT_QM_NUM_TEMP_FILE_SPILLS);
     }
 
   /* try to get pages from an external temp file */
@@ -2551,6 +2726,144 @@ qmgr_get_external_file_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_F
   return page_p;
 }
 
+/*
+ * qmgr_extend_membuf () - Extend memory buffer of temp file with a new chunk of pages and return the first new page.
+ *
+ * return	     : New memory page or NULL if memory budget is exhausted.
+ * thread_p (in)     : Thread entry.
+ * vpid_p (out)	     : Set to the memory page identifier.
+ * tfile_vfid_p (in) : Temp file with exhausted memory buffer.
+ *
+ * NOTE: Each chunk doubles the memory pages of temp file. Chunks are limited by the memory pages a transaction may use
+ *	 for its temp files and by the memory pages of all temp files. When they are exceeded, the temp file pages are
+ *	 allocated from temporary volumes.
+ */
+static PAGE_PTR
+qmgr_extend_membuf (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfile_vfid_p)
+{
+  QMGR_TRAN_ENTRY *tran_entry_p;
+  QFILE_PAGE_HEADER pgheader = { 0, NULL_PAGEID, NULL_PAGEID, 0, NULL_PAGEID, NULL_VOLID, NULL_VOLID, NULL_VOLID };
+  PAGE_PTR chunk_p = NULL, page_p;
+  PAGE_PTR *membuf_p = NULL;
+  int tran_index, total_pages, npages, i;
+
+  assert (tfile_vfid_p->membuf != NULL && VFID_ISNULL (&tfile_vfid_p->temp_vfid));
+
+  total_pages = tfile_vfid_p->membuf_npages + tfile_vfid_p->membuf_ext_npages;
+  assert (tfile_vfid_p->membuf_last == total_pages - 1);
+
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  if (tfile_vfid_p->membuf_ext_nchunks >= QMGR_MEMBUF_EXT_MAX_CHUNKS || qmgr_Query_table.tran_entries_p == NULL
+      || tran_index < 0 || tran_index >= qmgr_Query_table.num_trans
+      || (tfile_vfid_p->membuf_ext_nchunks > 0 && tfile_vfid_p->membuf_ext_tran_index != tran_index))
+    {
+      return NULL;
+    }
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+
+  npages = MAX (total_pages, 1);
+  npages = MIN (npages, prm_get_integer_value (PRM_ID_TEMP_FILE_MAX_MEMORY_PAGES) - tran_entry_p->membuf_ext_pages);
+  if (npages <= 0)
+    {
+      return NULL;
+    }
+
+  if (ATOMIC_INC_32 (&qmgr_Query_table.membuf_ext_pages, npages)
+      > prm_get_integer_value (PRM_ID_TEMP_FILE_TOTAL_MEMORY_PAGES))
+    {
+      /* server memory budget is exhausted */
+      ATOMIC_INC_32 (&qmgr_Query_table.membuf_ext_pages, -npages);
+      return NULL;
+    }
+
+  /* no error is set on failed allocations; the pages can still be allocated from temporary volumes */
+  chunk_p = (PAGE_PTR) malloc ((size_t) npages * DB_PAGESIZE);
+  if (chunk_p == NULL)
+    {
+      goto exit_on_failure;
+    }
+  if (tfile_vfid_p->membuf_ext_nchunks == 0)
+    {
+      /* membuf pointers are moved out of the temp file structure */
+      membuf_p = (PAGE_PTR *) malloc ((total_pages + npages) * sizeof (PAGE_PTR));
+      if (membuf_p != NULL)
+	{
+	  memcpy (membuf_p, tfile_vfid_p->membuf, total_pages * sizeof (PAGE_PTR));
+	}
+    }
+  else
+    {
+      membuf_p = (PAGE_PTR *) realloc (tfile_vfid_p->membuf, (total_pages + npages) * sizeof (PAGE_PTR));
+    }
+  if (membuf_p == NULL)
+    {
+      goto exit_on_failure;
+    }
+  tfile_vfid_p->membuf = membuf_p;
+
+  page_p = chunk_p;
+  for (i = 0; i < npages; i++)
+    {
+      tfile_vfid_p->membuf[total_pages + i] = page_p;
+      qmgr_put_page_header (page_p, &pgheader);
+      page_p += DB_PAGESIZE;
+    }
+
+  tfile_vfid_p->membuf_ext_chunks[tfile_vfid_p->membuf_ext_nchunks] = chunk_p;
+  tfile_vfid_p->membuf_ext_chunk_npages[tfile_vfid_p->membuf_ext_nchunks] = npages;
+  tfile_vfid_p->membuf_ext_nchunks++;
+  tfile_vfid_p->membuf_ext_npages += npages;
+  tfile_vfid_p->membuf_ext_tran_index = tran_index;
+  ATOMIC_INC_32 (&tran_entry_p->membuf_ext_pages, npages);
+
+  perfmon_add_stat (thread_p, PSTAT_QM_NUM_TEMP_MEMORY_PAGES, npages);
+
+  vpid_p->volid = NULL_VOLID;
+  vpid_p->pageid = ++(tfile_vfid_p->membuf_last);
+  return tfile_vfid_p->membuf[tfile_vfid_p->membuf_last];
+
+exit_on_failure:
+  if (chunk_p != NULL)
+    {
+      free_and_init (chunk_p);
+    }
+  ATOMIC_INC_32 (&qmgr_Query_table.membuf_ext_pages, -npages);
+  return NULL;
+}
+
+/*
+ * qmgr_free_membuf_ext () - Free the memory chunks extending memory buffer of temp file.
+ *
+ * return	     : Void.
+ * tfile_vfid_p (in) : Temp file.
+ */
+static void
+qmgr_free_membuf_ext (QMGR_TEMP_FILE * tfile_vfid_p)
+{
+  int i;
+
+  if (tfile_vfid_p->membuf_ext_nchunks == 0)
+    {
+      return;
+    }
+
+  for (i = 0; i < tfile_vfid_p->membuf_ext_nchunks; i++)
+    {
+      free_and_init (tfile_vfid_p->membuf_ext_chunks[i]);
+    }
+  free_and_init (tfile_vfid_p->membuf);
+
+  ATOMIC_INC_32 (&qmgr_Query_table.membuf_ext_pages, -tfile_vfid_p->membuf_ext_npages);
+  if (qmgr_Query_table.tran_entries_p != NULL && tfile_vfid_p->membuf_ext_tran_index < qmgr_Query_table.num_trans)
+    {
+      ATOMIC_INC_32 (&qmgr_Query_table.tran_entries_p[tfile_vfid_p->membuf_ext_tran_index].membuf_ext_pages,
+		     -tfile_vfid_p->membuf_ext_npages);
+    }
+
+  tfile_vfid_p->membuf_ext_nchunks = 0;
+  tfile_vfid_p->membuf_ext_npages = 0;
+}
+
 static QMGR_TEMP_FILE *
 qmgr_allocate_tempfile_with_buffer (int num_buffer_pages)
 {
@@ -2709,6 +3022,8 @@ qmgr_create_result_file (THREAD_ENTRY * thread_p, QUERY_ID query_id)
   tfile_vfid_p->membuf = NULL;
   tfile_vfid_p->membuf_npages = 0;
   tfile_vfid_p->membuf_type = TEMP_FILE_MEMBUF_NONE;
+  tfile_vfid_p->membuf_ext_nchunks = 0;
+  tfile_vfid_p->membuf_ext_npages = 0;
 
   /* Find the query entry and chain the created temp file to the entry */
 
@@ -3236,6 +3551,8 @@ qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p)
       return;
     }
 
+  /* memory extension is not kept in free list */
+  qmgr_free_membuf_ext (temp_file_p);
   temp_file_p->membuf_last = -1;
 
   if (QMGR_IS_VALID_MEMBUF_TYPE (temp_file_p->membuf_type))
@@ -73,6 +73,9 @@ typedef enum
   QMGR_TRAN_TERMINATED		/* Terminated transaction */
 } QMGR_TRAN_STATUS;
 
+/* each chunk doubles the memory pages of a temp file, therefore few chunks are needed */
+#define QMGR_MEMBUF_EXT_MAX_CHUNKS 16
+
 typedef struct qmgr_temp_file QMGR_TEMP_FILE;
 struct qmgr_temp_file
 {
@@ -84,6 +87,13 @@ struct qmgr_temp_file
   PAGE_PTR *membuf;
   int membuf_npages;
   QMGR_TEMP_FILE_MEMBUF_TYPE membuf_type;
+
+  /* memory chunks extending membuf before the temp file is created; their pages follow membuf_npages in membuf */
+  PAGE_PTR membuf_ext_chunks[QMGR_MEMBUF_EXT_MAX_CHUNKS];
+  int membuf_ext_chunk_npages[QMGR_MEMBUF_EXT_MAX_CHUNKS];
+  int membuf_ext_nchunks;
+  int membuf_ext_npages;	/* total pages in extension chunks */
+  int membuf_ext_tran_index;	/* transaction charged with the extension pages */
 };
 
 /*
@@ -149,6 +159,7 @@ extern void qmgr_set_tran_status (THREAD_ENTRY * thread_p, int tran_index, QMGR_
 extern int qmgr_get_query_error_with_entry (QMGR_QUERY_ENTRY * query_entryp);
 #endif /* ENABLE_UNUSED_FUNCTION */
 extern void qmgr_add_modified_class (THREAD_ENTRY * thread_p, const OID * class_oid);
+extern void qmgr_clear_modified_classes (THREAD_ENTRY * thread_p, int tran_index);
 extern PAGE_PTR qmgr_get_old_page (THREAD_ENTRY * thread_p, VPID * vpidp, QMGR_TEMP_FILE * tfile_vfidp);
 extern void qmgr_free_old_page (THREAD_ENTRY * thread_p, PAGE_PTR page_ptr, QMGR_TEMP_FILE * tfile_vfidp);
 extern void qmgr_set_dirty_page (THREAD_ENTRY * thread_p, PAGE_PTR page_ptr, int free_page, LOG_DATA_ADDR * addrp,
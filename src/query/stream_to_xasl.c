@@ -2557,7 +2557,7 @@ stx_build_buildlist_proc (THREAD_ENTRY * thread_p, char *ptr, BUILDLIST_PROC_NOD
   XASL_UNPACK_INFO *xasl_unpack_info = get_xasl_unpack_info_ptr (thread_p);
 
   stx_build_list_proc->output_columns = (DB_VALUE **) 0;
-  stx_build_list_proc->upddel_oid_locator_ehids = NULL;
+  stx_build_list_proc->upddel_oid_sets = NULL;
 
   ptr = or_unpack_int (ptr, &offset);
   if (offset == 0)
@@ -53,10 +53,13 @@
 #endif // SERVER_MODE
 #include "util_func.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <stack>
+#include <unordered_map>
 
 #include <cstring>
 
@@ -489,6 +492,39 @@ lockfree::circular_queue<VACUUM_LOG_BLOCKID> *vacuum_Finished_job_queue = NULL;
 /* Static array of vacuum workers */
 VACUUM_WORKER vacuum_Workers[VACUUM_MAX_WORKER_COUNT];
 
+/* Number of heap objects claimed at once when the heap objects of a job are vacuumed. */
+#define VACUUM_HEAP_JOB_CHUNK_OBJECTS 32
+
+/* Cumulative vacuum progress of heap files (one heap file per class), reported in vacuum heap logging. */
+typedef struct vacuum_heap_file_progress VACUUM_HEAP_FILE_PROGRESS;
+struct vacuum_heap_file_progress
+{
+  OID class_oid;		/* class owning the heap file */
+  UINT64 n_pages;		/* heap pages vacuumed */
+  UINT64 n_objects;		/* heap objects vacuumed */
+};
+
+// *INDENT-OFF*
+struct vacuum_vfid_hash
+{
+  size_t operator() (const VFID &vfid) const
+  {
+    return std::hash<INT64> () ((((INT64) vfid.volid) << 32) | (UINT32) vfid.fileid);
+  }
+};
+
+struct vacuum_vfid_equal
+{
+  bool operator() (const VFID &a, const VFID &b) const
+  {
+    return VFID_EQ (&a, &b);
+  }
+};
+
+static std::mutex vacuum_Heap_progress_mutex;
+static std::unordered_map<VFID, VACUUM_HEAP_FILE_PROGRESS, vacuum_vfid_hash, vacuum_vfid_equal> vacuum_Heap_progress;
+// *INDENT-ON*
+
 /* VACUUM_HEAP_HELPER -
  * Structure used by vacuum heap functions.
  */
@@ -694,6 +730,8 @@ static int vacuum_compare_heap_object (const void *a, const void *b);
 static int vacuum_collect_heap_objects (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, OID * oid, VFID * vfid);
 static void vacuum_cleanup_collected_by_vfid (VACUUM_WORKER * worker, VFID * vfid);
 static int vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted);
+static void vacuum_heap_progress_add (THREAD_ENTRY * thread_p, const VFID * vfid, int n_pages, int n_objects);
+static void vacuum_heap_progress_remove (const VFID * vfid);
 static int vacuum_heap_prepare_record (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
 static int vacuum_heap_record_insid_and_prev_version (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
 static int vacuum_heap_record (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
@@ -918,6 +956,83 @@ class vacuum_worker_task : public cubthread::entry_task
     VACUUM_DATA_ENTRY m_data;
 };
 
+// class vacuum_heap_job
+//
+//  description:
+//    heap objects collected by one vacuum job, sorted by file and page. the objects are claimed in chunks by the
+//    worker owning the job and by other vacuum workers that help it; a heap page belongs to the chunk where its first
+//    object is, so each page is vacuumed by exactly one worker.
+//
+class vacuum_heap_job
+{
+  public:
+    vacuum_heap_job (VACUUM_HEAP_OBJECT *objects, int n_objects, MVCCID threshold_mvccid, bool was_interrupted)
+      : m_objects (objects)
+      , m_n_objects (n_objects)
+      , m_threshold_mvccid (threshold_mvccid)
+      , m_was_interrupted (was_interrupted)
+      , m_next_object { 0 }
+      , m_mutex ()
+      , m_cond ()
+      , m_helper_count (0)
+      , m_helper_error (NO_ERROR)
+      , m_is_closed (false)
+    {
+    }
+
+    int execute (THREAD_ENTRY *thread_p, bool is_helper);
+
+    // helpers must be admitted before executing; they are refused once the owner closed the job
+    bool start_helper ();
+    void end_helper (int error_code);
+    // refuse new helpers and wait for the running ones; returns the error of a failed helper
+    int close ();
+
+  private:
+    bool is_same_page (int first, int second) const
+    {
+      return (m_objects[first].oid.pageid == m_objects[second].oid.pageid
+              && m_objects[first].oid.volid == m_objects[second].oid.volid);
+    }
+
+    VACUUM_HEAP_OBJECT *m_objects;        // owned by the vacuum worker executing the job
+    int m_n_objects;
+    MVCCID m_threshold_mvccid;
+    bool m_was_interrupted;
+    std::atomic<int> m_next_object;       // first object of the next unclaimed chunk
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    int m_helper_count;
+    int m_helper_error;
+    bool m_is_closed;
+};
+
+#if defined (SERVER_MODE)
+// class vacuum_heap_help_task
+//
+//  description:
+//    task executed by another vacuum worker to vacuum a part of the heap objects of a large job
+//
+class vacuum_heap_help_task : public cubthread::entry_task
+{
+  public:
+    vacuum_heap_help_task (const std::shared_ptr<vacuum_heap_job> &job, INT32 drop_files_version)
+      : m_job (job)
+      , m_drop_files_version (drop_files_version)
+    {
+    }
+
+    void execute (cubthread::entry &thread_ref) final;
+
+  private:
+    vacuum_heap_help_task ();
+
+    std::shared_ptr<vacuum_heap_job> m_job;
+    INT32 m_drop_files_version;   // version seen by the owner; the job files cannot be cleaned before the owner ends
+};
+#endif // SERVER_MODE
+
 // vacuum master globals
 static cubthread::daemon *vacuum_Master_daemon = NULL;                       // daemon thread
 static vacuum_master_context_manager *vacuum_Master_context_manager = NULL;  // context manager
@@ -1408,13 +1523,14 @@ vacuum_finalize (THREAD_ENTRY * thread_p)
 static int
 vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted)
 {
-  VACUUM_HEAP_OBJECT *page_ptr;
-  VACUUM_HEAP_OBJECT *obj_ptr;
   int error_code = NO_ERROR;
-  VFID vfid = VFID_INITIALIZER;
-  HFID hfid = HFID_INITIALIZER;
-  bool reusable = false;
-  int object_count = 0;
+  int helper_error = NO_ERROR;
+#if defined (SERVER_MODE)
+  int min_pages = prm_get_integer_value (PRM_ID_VACUUM_HEAP_PARALLEL_MIN_PAGES);
+  int n_pages = 1;
+  int n_helpers = 0;
+  int i;
+#endif /* SERVER_MODE */
 
   if (worker->n_heap_objects == 0)
     {
@@ -1429,53 +1545,296 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
    * each different heap page. */
   qsort (worker->heap_objects, worker->n_heap_objects, sizeof (VACUUM_HEAP_OBJECT), vacuum_compare_heap_object);
 
-  /* Start parsing array. Vacuum objects page by page. */
-  for (page_ptr = worker->heap_objects; page_ptr < worker->heap_objects + worker->n_heap_objects;)
+  /* *INDENT-OFF* */
+  std::shared_ptr<vacuum_heap_job> job =
+    std::make_shared<vacuum_heap_job> (worker->heap_objects, worker->n_heap_objects, threshold_mvccid,
+                                       was_interrupted);
+  /* *INDENT-ON* */
+
+#if defined (SERVER_MODE)
+  /* A job with many heap pages (e.g. the block of a bulk update) is shared with other vacuum workers, so they don't
+   * stay idle while this worker vacuums all its pages. */
+  if (min_pages > 0 && worker->n_heap_objects > min_pages)
     {
-      if (!VFID_EQ (&vfid, &page_ptr->vfid))
+      for (i = 1; i < worker->n_heap_objects; i++)
 	{
-	  VFID_COPY (&vfid, &page_ptr->vfid);
-	  /* Reset HFID */
-	  HFID_SET_NULL (&hfid);
+	  if (worker->heap_objects[i].oid.pageid != worker->heap_objects[i - 1].oid.pageid
+	      || worker->heap_objects[i].oid.volid != worker->heap_objects[i - 1].oid.volid)
+	    {
+	      n_pages++;
+	    }
 	}
-
-      /* Find all objects for this page. */
-      object_count = 1;
-      for (obj_ptr = page_ptr + 1;
-	   obj_ptr < worker->heap_objects + worker->n_heap_objects && obj_ptr->oid.pageid == page_ptr->oid.pageid
-	   && obj_ptr->oid.volid == page_ptr->oid.volid; obj_ptr++)
+      n_helpers = MIN (n_pages / min_pages, prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT) - 1);
+      for (i = 0; i < n_helpers && !cubthread::get_manager ()->is_pool_full (vacuum_Worker_threads); i++)
 	{
-	  object_count++;
+	  cubthread::get_manager ()->push_task (vacuum_Worker_threads,
+						new vacuum_heap_help_task (job, worker->drop_files_version));
 	}
-      /* Vacuum page. */
-      error_code =
-	vacuum_heap_page (thread_p, page_ptr, object_count, threshold_mvccid, &hfid, &reusable, was_interrupted);
-      if (error_code != NO_ERROR)
+      if (i > 0)
 	{
-	  vacuum_check_shutdown_interruption (thread_p, error_code);
+	  vacuum_er_log (VACUUM_ER_LOG_HEAP | VACUUM_ER_LOG_WORKER,
+			 "share vacuum of %d heap pages (%d objects) with %d workers", n_pages,
+			 worker->n_heap_objects, i);
+	}
+    }
+#endif /* SERVER_MODE */
 
-	  vacuum_er_log_error (VACUUM_ER_LOG_HEAP, "Vacuum heap page %d|%d, error_code=%d.",
-			       page_ptr->oid.volid, page_ptr->oid.pageid);
+  error_code = job->execute (thread_p, false);
+
+  /* The objects belong to this worker; no helper may use them after the job ends. */
+  helper_error = job->close ();
+  if (error_code == NO_ERROR)
+    {
+      error_code = helper_error;
+    }
+
+  return error_code;
+}
+
+/* *INDENT-OFF* */
+/*
+ * vacuum_heap_job::execute () - Claim chunks of heap objects and vacuum their pages until no objects are left.
+ *
+ * return	   : Error code.
+ * thread_p (in)   : Thread entry.
+ * is_helper (in)  : True if thread helps the worker owning the job.
+ */
+int
+vacuum_heap_job::execute (THREAD_ENTRY *thread_p, bool is_helper)
+{
+  VFID vfid = VFID_INITIALIZER;
+  HFID hfid = HFID_INITIALIZER;
+  bool reusable = false;
+  int file_pages = 0;
+  int file_objects = 0;
+  int error_code = NO_ERROR;
+  int chunk_start, chunk_end;
+  int page_start, page_end;
+
+  for (chunk_start = m_next_object.fetch_add (VACUUM_HEAP_JOB_CHUNK_OBJECTS); chunk_start < m_n_objects;
+       chunk_start = m_next_object.fetch_add (VACUUM_HEAP_JOB_CHUNK_OBJECTS))
+    {
+      chunk_end = std::min (chunk_start + VACUUM_HEAP_JOB_CHUNK_OBJECTS, m_n_objects);
+
+      /* Skip the objects of a page that started in a previous chunk. */
+      page_start = chunk_start;
+      while (page_start > 0 && page_start < chunk_end && is_same_page (page_start - 1, page_start))
+        {
+          page_start++;
+        }
+
+      /* Vacuum all pages starting in this chunk; the last may end in the next chunks. */
+      for (; page_start < chunk_end; page_start = page_end)
+        {
+          if (!VFID_EQ (&vfid, &m_objects[page_start].vfid))
+            {
+              vacuum_heap_progress_add (thread_p, &vfid, file_pages, file_objects);
+              file_pages = file_objects = 0;
+
+              VFID_COPY (&vfid, &m_objects[page_start].vfid);
+              /* Reset HFID */
+              HFID_SET_NULL (&hfid);
+            }
+
+          /* Find all objects for this page. */
+          page_end = page_start + 1;
+          while (page_end < m_n_objects && is_same_page (page_start, page_end))
+            {
+              page_end++;
+            }
+
+          /* Vacuum page. */
+          error_code = vacuum_heap_page (thread_p, &m_objects[page_start], page_end - page_start, m_threshold_mvccid,
+                                         &hfid, &reusable, m_was_interrupted);
+          if (error_code != NO_ERROR)
+            {
+              vacuum_check_shutdown_interruption (thread_p, error_code);
+
+              vacuum_er_log_error (VACUUM_ER_LOG_HEAP, "Vacuum heap page %d|%d, error_code=%d.",
+                                   m_objects[page_start].oid.volid, m_objects[page_start].oid.pageid, error_code);
 
 #if defined (NDEBUG)
-	  if (!thread_p->shutdown)
-	    {
-	      // unexpected case
-	      // debug crashes; but can release do about it? just try to clean as much as possible
-	      er_clear ();
-	      error_code = NO_ERROR;
-	      continue;
-	    }
+              if (!thread_p->shutdown)
+                {
+                  // unexpected case
+                  // debug crashes; but can release do about it? just try to clean as much as possible
+                  er_clear ();
+                  error_code = NO_ERROR;
+                  continue;
+                }
 #endif // not DEBUG
 
-	  return error_code;
-	}
-      /* Advance to next page. */
-      page_ptr = obj_ptr;
+              /* Stop the other workers of the job too. */
+              m_next_object.store (m_n_objects);
+              vacuum_heap_progress_add (thread_p, &vfid, file_pages, file_objects);
+              return error_code;
+            }
+
+          file_pages++;
+          file_objects += page_end - page_start;
+          if (is_helper)
+            {
+              perfmon_inc_stat (thread_p, PSTAT_VAC_NUM_SHARED_HEAP_PAGES);
+            }
+        }
     }
+
+  vacuum_heap_progress_add (thread_p, &vfid, file_pages, file_objects);
   return NO_ERROR;
 }
 
+bool
+vacuum_heap_job::start_helper ()
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  if (m_is_closed)
+    {
+      return false;
+    }
+  m_helper_count++;
+  return true;
+}
+
+void
+vacuum_heap_job::end_helper (int error_code)
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  assert (m_helper_count > 0);
+  if (error_code != NO_ERROR && m_helper_error == NO_ERROR)
+    {
+      m_helper_error = error_code;
+    }
+  if (--m_helper_count == 0)
+    {
+      m_cond.notify_all ();
+    }
+}
+
+int
+vacuum_heap_job::close ()
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  m_is_closed = true;
+  m_cond.wait (ulock, [this] { return m_helper_count == 0; });
+  return m_helper_error;
+}
+
+#if defined (SERVER_MODE)
+void
+vacuum_heap_help_task::execute (cubthread::entry &thread_ref)
+{
+  VACUUM_WORKER *worker = vacuum_get_vacuum_worker (&thread_ref);
+  int error_code;
+
+  // safe-guard - check interrupt is always false
+  assert (!thread_ref.check_interrupt);
+  assert (worker != NULL);
+
+  if (!m_job->start_helper ())
+    {
+      // the owner already vacuumed all objects
+      return;
+    }
+
+  worker->drop_files_version = m_drop_files_version;
+  worker->state = VACUUM_WORKER_STATE_EXECUTE;
+
+  error_code = m_job->execute (&thread_ref, true);
+
+  assert (!LOG_FIND_CURRENT_TDES (&thread_ref)->is_under_sysop ());
+  worker->state = VACUUM_WORKER_STATE_INACTIVE;
+  /* Unfix all pages now. Normally all pages should already be unfixed. */
+  pgbuf_unfix_all (&thread_ref);
+
+  m_job->end_helper (error_code);
+}
+#endif // SERVER_MODE
+/* *INDENT-ON* */
+
+/*
+ * vacuum_heap_progress_add () - Add vacuumed pages and objects to the progress of a heap file.
+ *
+ * return	  : Void.
+ * thread_p (in)  : Thread entry.
+ * vfid (in)	  : Heap file identifier.
+ * n_pages (in)	  : Number of vacuumed heap pages.
+ * n_objects (in) : Number of vacuumed heap objects.
+ *
+ * Note: The totals of a file are kept only while VACUUM_ER_LOG_HEAP logging is enabled.
+ */
+static void
+vacuum_heap_progress_add (THREAD_ENTRY * thread_p, const VFID * vfid, int n_pages, int n_objects)
+{
+  FILE_DESCRIPTORS file_descriptor;
+  OID class_oid = OID_INITIALIZER;
+  UINT64 total_pages, total_objects;
+
+  if (n_pages == 0)
+    {
+      return;
+    }
+
+  perfmon_add_stat (thread_p, PSTAT_VAC_NUM_HEAP_PAGES, n_pages);
+  perfmon_add_stat (thread_p, PSTAT_VAC_NUM_HEAP_OBJECTS, n_objects);
+
+  if (!VACUUM_IS_ER_LOG_LEVEL_SET (VACUUM_ER_LOG_HEAP))
+    {
+      /* the per-class totals are only logged; do not pay for the file descriptor and the mutex */
+      return;
+    }
+
+  /* *INDENT-OFF* */
+  std::unique_lock<std::mutex> ulock (vacuum_Heap_progress_mutex);
+  auto it = vacuum_Heap_progress.find (*vfid);
+  if (it == vacuum_Heap_progress.end ())
+    {
+      /* First time the file is vacuumed; read its class without holding the mutex. */
+      ulock.unlock ();
+      if (file_descriptor_get (thread_p, vfid, &file_descriptor) == NO_ERROR)
+	{
+	  COPY_OID (&class_oid, &file_descriptor.heap.class_oid);
+	}
+      else
+	{
+	  er_clear ();
+	}
+      ulock.lock ();
+      it = vacuum_Heap_progress.emplace (*vfid, VACUUM_HEAP_FILE_PROGRESS { class_oid, 0, 0 }).first;
+    }
+  /* *INDENT-ON* */
+
+  it->second.n_pages += n_pages;
+  it->second.n_objects += n_objects;
+  COPY_OID (&class_oid, &it->second.class_oid);
+  total_pages = it->second.n_pages;
+  total_objects = it->second.n_objects;
+  ulock.unlock ();
+
+  vacuum_er_log (VACUUM_ER_LOG_HEAP,
+		 "vacuumed %d pages and %d objects of class %d|%d|%d in heap file %d|%d; "
+		 "class total is %llu pages and %llu objects", n_pages, n_objects, OID_AS_ARGS (&class_oid),
+		 VFID_AS_ARGS (vfid), (unsigned long long int) total_pages, (unsigned long long int) total_objects);
+}
+
+/*
+ * vacuum_heap_progress_remove () - Forget the vacuum progress of a dropped file.
+ *
+ * return    : Void.
+ * vfid (in) : File identifier.
+ */
+static void
+vacuum_heap_progress_remove (const VFID * vfid)
+{
+  /* *INDENT-OFF* */
+  std::unique_lock<std::mutex> ulock (vacuum_Heap_progress_mutex);
+  /* *INDENT-ON* */
+
+  vacuum_Heap_progress.erase (*vfid);
+}
+
 /*
  * vacuum_heap_page () - Vacuum objects in one heap page.
  *
@@ -1816,6 +2175,87 @@ end:
   return error_code;
 }
 
+/*
+ * vacuum_heap_page_prune () - Remove the dead versions of home records from a heap page before vacuum gets to them.
+ *
+ * return	    : Number of removed records.
+ * thread_p (in)    : Thread entry.
+ * page_p (in)	    : Heap page fixed with write latch.
+ * skip_slotid (in) : Slot of the object changed by caller. It is not pruned.
+ *
+ * NOTE: Only REC_HOME records deleted before the global oldest visible MVCCID are removed; relocated and big records
+ *	 need other pages and are left to vacuum. The slots are marked deleted without being reused, therefore the
+ *	 caller must not prune heap files with reusable slots. Vacuum later finds these objects already removed and
+ *	 skips them, while their b-tree entries are vacuumed as usual.
+ */
+int
+vacuum_heap_page_prune (THREAD_ENTRY * thread_p, PAGE_PTR page_p, PGSLOTID skip_slotid)
+{
+  PGSLOTID slots[MAX_SLOTS_IN_PAGE];
+  MVCC_SATISFIES_VACUUM_RESULT results[MAX_SLOTS_IN_PAGE];
+  MVCCID threshold_mvccid;
+  MVCC_REC_HEADER mvcc_header;
+  SPAGE_SLOT *slotp = NULL;
+  RECDES recdes;
+  PGSLOTID slotid;
+  int num_slots;
+  int n_pruned = 0;
+
+  assert (page_p != NULL);
+  assert (pgbuf_get_latch_mode (page_p) == PGBUF_LATCH_WRITE);
+
+  if (prm_get_bool_value (PRM_ID_DISABLE_VACUUM))
+    {
+      return 0;
+    }
+
+  threshold_mvccid = log_Gl.mvcc_table.get_global_oldest_visible ();
+  num_slots = spage_number_of_slots (page_p);
+
+  /* Slot 0 holds the heap page header. */
+  for (slotid = 1; slotid < num_slots; slotid++)
+    {
+      if (slotid == skip_slotid)
+	{
+	  continue;
+	}
+      slotp = spage_get_slot (page_p, slotid);
+      if (slotp == NULL || slotp->record_type != REC_HOME)
+	{
+	  continue;
+	}
+      if (spage_get_record (thread_p, page_p, slotid, &recdes, PEEK) != S_SUCCESS
+	  || or_mvcc_get_header (&recdes, &mvcc_header) != NO_ERROR)
+	{
+	  assert_release (false);
+	  er_clear ();
+	  continue;
+	}
+      if (!MVCC_IS_HEADER_DELID_VALID (&mvcc_header)
+	  || mvcc_satisfies_vacuum (thread_p, &mvcc_header, threshold_mvccid) != VACUUM_RECORD_REMOVE)
+	{
+	  continue;
+	}
+
+      spage_vacuum_slot (thread_p, page_p, slotid, false);
+      slots[n_pruned] = slotid;
+      results[n_pruned] = VACUUM_RECORD_REMOVE;
+      n_pruned++;
+    }
+
+  if (n_pruned > 0)
+    {
+      vacuum_log_vacuum_heap_page (thread_p, page_p, n_pruned, slots, results, false, false);
+      pgbuf_set_dirty (thread_p, page_p, DONT_FREE);
+
+      perfmon_add_stat (thread_p, PSTAT_HEAP_PRUNED_RECORDS, n_pruned);
+      vacuum_er_log (VACUUM_ER_LOG_HEAP, "Pruned %d records from heap page %d|%d, lsa=%lld|%d.", n_pruned,
+		     PGBUF_PAGE_STATE_ARGS (page_p));
+    }
+
+  return n_pruned;
+}
+
 /*
  * vacuum_heap_prepare_record () - Prepare all required information to vacuum heap record. Possible requirements:
  *				   - Record type (always).
@@ -5713,6 +6153,8 @@ vacuum_add_dropped_file (THREAD_ENTRY * thread_p, VFID * vfid, MVCCID mvccid)
 
   assert (tdes != NULL);
 
+  vacuum_heap_progress_remove (vfid);
+
   if (!vacuum_Dropped_files_loaded)
     {
       /* Normally, dropped files are loaded after recovery, in order to provide a consistent state of its pages.
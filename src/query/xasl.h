@@ -156,6 +156,8 @@ typedef struct xasl_stat XASL_STATS;
 typedef struct topn_tuple TOPN_TUPLE;
 typedef struct topn_tuples TOPN_TUPLES;
 
+typedef struct upddel_oid_set UPDDEL_OID_SET;
+
 // *INDENT-OFF*
 namespace cubquery
 {
@@ -334,8 +336,8 @@ struct buildlist_proc_node
   int g_hkey_size;		/* group by key size */
   int g_func_count;		/* aggregate function count */
 #if defined (SERVER_MODE) || defined (SA_MODE)
-  EHID *upddel_oid_locator_ehids;	/* array of temporary extensible hash for UPDATE/DELETE generated SELECT
-					 * statement */
+  UPDDEL_OID_SET *upddel_oid_sets;	/* array of OID sets for duplicate elimination in UPDATE/DELETE generated
+					 * SELECT statement */
   AGGREGATE_HASH_CONTEXT *agg_hash_context;	/* hash aggregate context, not serialized */
 #endif				/* defined (SERVER_MODE) || defined (SA_MODE) */
   int g_agg_domains_resolved;	/* domain status (not serialized) */
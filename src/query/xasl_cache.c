@@ -25,7 +25,6 @@
 
 #include "xasl_cache.h"
 
-#include "binaryheap.h"
 #include "compile_context.h"
 #include "config.h"
 #include "system_parameter.h"
@@ -92,6 +91,15 @@ struct xcache_cleanup_candidate
   struct timeval time_last_used;
 };
 
+/* Slot of the CLOCK ring. The entry pointer stays valid memory while the hash map lives (entries are only recycled
+ * through its freelist); the key copy detects whether the slot still tracks the same cached plan. */
+typedef struct xcache_clock_slot XCACHE_CLOCK_SLOT;
+struct xcache_clock_slot
+{
+  XASL_CACHE_ENTRY *entry;	/* tracked entry or NULL if slot is free */
+  XASL_ID xid;			/* key of tracked entry */
+};
+
 // *INDENT-OFF*
 using xcache_hashmap_type = cubthread::lockfree_hashmap<xasl_id, xasl_cache_ent>;
 using xcache_hashmap_iterator = xcache_hashmap_type::iterator;
@@ -110,8 +118,12 @@ struct xcache
   bool logging_enabled;
   int max_clones;
   INT32 cleanup_flag;
-  BINARY_HEAP *cleanup_bh;
   XCACHE_CLEANUP_CANDIDATE *cleanup_array;
+  XCACHE_CLOCK_SLOT *clock_ring;
+  int clock_ring_size;
+  int clock_hand;
+  int clock_next_free;
+  pthread_mutex_t clock_mutex;
 
   XCACHE_STATS stats;
 
@@ -126,8 +138,12 @@ struct xcache
     , logging_enabled (false)
     , max_clones (0)
     , cleanup_flag (0)
-    , cleanup_bh (NULL)
     , cleanup_array (NULL)
+    , clock_ring (NULL)
+    , clock_ring_size (0)
+    , clock_hand (0)
+    , clock_next_free (0)
+    , clock_mutex ()
     , stats XCACHE_STATS_INITIALIZER
   {
   }
@@ -146,8 +162,12 @@ XCACHE xcache_Global;
 #define xcache_Log xcache_Global.logging_enabled
 #define xcache_Max_clones xcache_Global.max_clones
 #define xcache_Cleanup_flag xcache_Global.cleanup_flag
-#define xcache_Cleanup_bh xcache_Global.cleanup_bh
 #define xcache_Cleanup_array xcache_Global.cleanup_array
+#define xcache_Clock_ring xcache_Global.clock_ring
+#define xcache_Clock_ring_size xcache_Global.clock_ring_size
+#define xcache_Clock_hand xcache_Global.clock_hand
+#define xcache_Clock_next_free xcache_Global.clock_next_free
+#define xcache_Clock_mutex xcache_Global.clock_mutex
 
 /* Statistics */
 #define XCACHE_STAT_GET(name) ATOMIC_LOAD_64 (&xcache_Global.stats.name)
@@ -188,11 +208,14 @@ static LF_ENTRY_DESCRIPTOR xcache_Entry_descriptor = {
 
 #define XCACHE_ATOMIC_CAS_CACHE_FLAG(xid, oldcf, newcf) (ATOMIC_CAS_32 (&(xid)->cache_flag, oldcf, newcf))
 
-/* Cleanup */
-#define XCACHE_CLEANUP_RATIO 0.2
-#define XCACHE_CLEANUP_MIN_NUM_ENTRIES 20
-#define XCACHE_CLEANUP_NUM_ENTRIES(capacity) \
-  (MAX ((int) (2 * XCACHE_CLEANUP_RATIO * (capacity)), XCACHE_CLEANUP_MIN_NUM_ENTRIES))
+/* CLOCK eviction. Each use of an entry refreshes its credit to a weight; the hand takes one credit from every unused
+ * entry it passes and evicts entries left without credit. */
+#define XCACHE_CLOCK_RING_SIZE(capacity) (2 * (capacity))
+#define XCACHE_CLOCK_MAX_COST_CREDIT 4
+#define XCACHE_CLOCK_LARGE_STREAM_SIZE (64 * 1024)
+#define XCACHE_CLOCK_EVICT_RATIO 0.01
+#define XCACHE_CLOCK_EVICT_BATCH(capacity) (MAX ((int) (XCACHE_CLOCK_EVICT_RATIO * (capacity)), 1))
+#define XCACHE_CLOCK_SWEEP_MAX_STEPS 4096
 
 
 /* Recompile threshold */
@@ -263,7 +286,15 @@ static bool xcache_entry_set_request_recompile_flag (THREAD_ENTRY * thread_p, XA
 						     bool set_flag);
 static void xcache_clone_decache (THREAD_ENTRY * thread_p, XASL_CLONE * xclone);
 static void xcache_cleanup (THREAD_ENTRY * thread_p);
-static BH_CMP_RESULT xcache_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_ARG ignore_arg);
+static INT32 xcache_clock_weight (int n_related_objects, int stream_size);
+static bool xcache_clock_slot_is_valid (XCACHE_CLOCK_SLOT * slot);
+static void xcache_clock_add (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
+static int xcache_clock_evict (THREAD_ENTRY * thread_p, int evict_count);
+static int xcache_clone_pool_max_clones (int pool_index);
+static bool xcache_clone_pool_push (XCACHE_CLONE_POOL * pool, int pool_index, XASL_CLONE * xclone);
+static bool xcache_entry_get_cached_clone (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry,
+					   XASL_CLONE * xclone);
+static void xcache_entry_decache_clones (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
 static bool xcache_check_recompilation_threshold (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
 static void xcache_invalidate_entries (THREAD_ENTRY * thread_p,
 				       bool (*invalidate_check) (XASL_CACHE_ENTRY *, const OID *), const OID * arg);
@@ -280,7 +311,6 @@ int
 xcache_initialize (THREAD_ENTRY * thread_p)
 {
   int error_code = NO_ERROR;
-  HL_HEAPID save_heapid;
 
   xcache_Enabled = false;
 
@@ -302,19 +332,20 @@ xcache_initialize (THREAD_ENTRY * thread_p)
   xcache_Hashmap.init (xcache_Ts, THREAD_TS_XCACHE, xcache_Soft_capacity, freelist_block_size, freelist_block_count,
 		       xcache_Entry_descriptor);
 
-  /* Use global heap */
-  save_heapid = db_change_private_heap (thread_p, 0);
   xcache_Cleanup_flag = 0;
-  xcache_Cleanup_bh = bh_create (thread_p, XCACHE_CLEANUP_NUM_ENTRIES (xcache_Soft_capacity),
-				 sizeof (XCACHE_CLEANUP_CANDIDATE), xcache_compare_cleanup_candidates, NULL);
-  (void) db_change_private_heap (thread_p, save_heapid);
-  if (xcache_Cleanup_bh == NULL)
+  xcache_Clock_ring_size = XCACHE_CLOCK_RING_SIZE (xcache_Soft_capacity);
+  xcache_Clock_ring = (XCACHE_CLOCK_SLOT *) calloc (xcache_Clock_ring_size, sizeof (XCACHE_CLOCK_SLOT));
+  if (xcache_Clock_ring == NULL)
     {
       xcache_Hashmap.destroy ();
-      xcache_log_error ("could not init hash table.\n");
-      ASSERT_ERROR_AND_SET (error_code);
-      return error_code;
+      xcache_log_error ("could not init clock ring.\n");
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      xcache_Clock_ring_size * sizeof (XCACHE_CLOCK_SLOT));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
     }
+  xcache_Clock_hand = 0;
+  xcache_Clock_next_free = 0;
+  pthread_mutex_init (&xcache_Clock_mutex, NULL);
 
   xcache_Cleanup_array = (XCACHE_CLEANUP_CANDIDATE *) malloc (xcache_Soft_capacity * sizeof (XCACHE_CLEANUP_CANDIDATE));
   if (xcache_Cleanup_array == NULL)
@@ -343,8 +374,6 @@ xcache_initialize (THREAD_ENTRY * thread_p)
 void
 xcache_finalize (THREAD_ENTRY * thread_p)
 {
-  HL_HEAPID save_heapid;
-
   if (!xcache_Enabled)
     {
       return;
@@ -355,14 +384,12 @@ xcache_finalize (THREAD_ENTRY * thread_p)
 
   xcache_Hashmap.destroy ();
 
-  /* Use global heap */
-  save_heapid = db_change_private_heap (thread_p, 0);
-  if (xcache_Cleanup_bh != NULL)
+  if (xcache_Clock_ring != NULL)
     {
-      bh_destroy (thread_p, xcache_Cleanup_bh);
-      xcache_Cleanup_bh = NULL;
+      free_and_init (xcache_Clock_ring);
+      xcache_Clock_ring_size = 0;
     }
-  (void) db_change_private_heap (thread_p, save_heapid);
+  pthread_mutex_destroy (&xcache_Clock_mutex);
 
   xcache_Enabled = false;
 }
@@ -370,24 +397,33 @@ xcache_finalize (THREAD_ENTRY * thread_p)
 // *INDENT-OFF*
 xasl_cache_ent::xasl_cache_ent ()
 {
-  pthread_mutex_init (&cache_clones_mutex, NULL);
+  for (XCACHE_CLONE_POOL &pool : clone_pools)
+    {
+      pthread_mutex_init (&pool.mutex, NULL);
+    }
   init_clone_cache ();
 }
 
 xasl_cache_ent::~xasl_cache_ent ()
 {
-  assert (cache_clones == NULL || cache_clones == &one_clone);
-  pthread_mutex_destroy (&cache_clones_mutex);
+  for (XCACHE_CLONE_POOL &pool : clone_pools)
+    {
+      assert (pool.clones == NULL || pool.clones == &pool.one_clone);
+      pthread_mutex_destroy (&pool.mutex);
+    }
 }
 
 void
 xasl_cache_ent::init_clone_cache ()
 {
-  cache_clones = &one_clone;
-  one_clone.xasl = NULL;
-  one_clone.xasl_buf = NULL;
-  cache_clones_capacity = 1;
-  n_cache_clones = 0;
+  for (XCACHE_CLONE_POOL &pool : clone_pools)
+    {
+      pool.clones = &pool.one_clone;
+      pool.one_clone.xasl = NULL;
+      pool.one_clone.xasl_buf = NULL;
+      pool.capacity = 1;
+      pool.n_clones = 0;
+    }
 }
 // *INDENT-ON*
 
@@ -405,7 +441,10 @@ xcache_entry_alloc (void)
       return NULL;
     }
   xcache_entry->init_clone_cache ();
-  pthread_mutex_init (&xcache_entry->cache_clones_mutex, NULL);
+  for (int pool_index = 0; pool_index < XCACHE_CLONE_POOL_COUNT; pool_index++)
+    {
+      pthread_mutex_init (&xcache_entry->clone_pools[pool_index].mutex, NULL);
+    }
   return xcache_entry;
 }
 
@@ -419,14 +458,19 @@ static int
 xcache_entry_free (void *entry)
 {
   XASL_CACHE_ENTRY *xcache_entry = (XASL_CACHE_ENTRY *) entry;
+  XCACHE_CLONE_POOL *pool;
 
-  if (xcache_entry->cache_clones != &xcache_entry->one_clone)
+  for (int pool_index = 0; pool_index < XCACHE_CLONE_POOL_COUNT; pool_index++)
     {
-      /* Should be already freed? */
-      assert (false);
-      free (xcache_entry->cache_clones);
+      pool = &xcache_entry->clone_pools[pool_index];
+      if (pool->clones != &pool->one_clone)
+	{
+	  /* Should be already freed? */
+	  assert (false);
+	  free (pool->clones);
+	}
+      pthread_mutex_destroy (&pool->mutex);
     }
-  pthread_mutex_destroy (&xcache_entry->cache_clones_mutex);
   free (entry);
   return NO_ERROR;
 }
@@ -444,6 +488,8 @@ xcache_entry_init (void *entry)
   /* Add here if anything should be initialized. */
   xcache_entry->related_objects = NULL;
   xcache_entry->ref_count = 0;
+  xcache_entry->clock_credit = 0;
+  xcache_entry->clock_weight = 1;
 
   xcache_entry->sql_info.sql_hash_text = NULL;
   xcache_entry->sql_info.sql_user_text = NULL;
@@ -456,7 +502,12 @@ xcache_entry_init (void *entry)
   xcache_entry->free_data_on_uninit = false;
   xcache_entry->initialized = true;
 
-  assert (xcache_entry->n_cache_clones == 0);
+#if !defined (NDEBUG)
+  for (int pool_index = 0; pool_index < XCACHE_CLONE_POOL_COUNT; pool_index++)
+    {
+      assert (xcache_entry->clone_pools[pool_index].n_clones == 0);
+    }
+#endif /* !NDEBUG */
   return NO_ERROR;
 }
 
@@ -506,22 +557,20 @@ xcache_entry_uninit (void *entry)
       XASL_ID_SET_NULL (&xcache_entry->xasl_id);
 
       /* Free XASL clones. */
-      assert (xcache_entry->n_cache_clones == 0
-	      || (xcache_Max_clones > 0 && xcache_entry->n_cache_clones <= xcache_Max_clones));
-      assert (xcache_entry->n_cache_clones == 0 || xcache_entry->cache_clones != NULL);
-      while (xcache_entry->n_cache_clones > 0)
-	{
-	  xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-	}
-      if (xcache_entry->cache_clones != &xcache_entry->one_clone)
+      xcache_entry_decache_clones (thread_p, xcache_entry);
+      for (int pool_index = 0; pool_index < XCACHE_CLONE_POOL_COUNT; pool_index++)
 	{
-	  /* Free cache clones. */
-	  assert (xcache_entry->cache_clones_capacity > 0);
-	  free (xcache_entry->cache_clones);
-	  xcache_entry->cache_clones = &xcache_entry->one_clone;
-	  xcache_entry->one_clone.xasl = NULL;
-	  xcache_entry->one_clone.xasl_buf = NULL;
-	  xcache_entry->cache_clones_capacity = 1;
+	  XCACHE_CLONE_POOL *pool = &xcache_entry->clone_pools[pool_index];
+	  if (pool->clones != &pool->one_clone)
+	    {
+	      /* Free cache clones. */
+	      assert (pool->capacity > 0);
+	      free (pool->clones);
+	      pool->clones = &pool->one_clone;
+	      pool->one_clone.xasl = NULL;
+	      pool->one_clone.xasl_buf = NULL;
+	      pool->capacity = 1;
+	    }
 	}
       if (xcache_entry->stream.buffer != NULL)
 	{
@@ -538,8 +587,6 @@ xcache_entry_uninit (void *entry)
       xcache_entry->sql_info.sql_plan_text = NULL;
       xcache_entry->sql_info.sql_user_text = NULL;
       XASL_ID_SET_NULL (&xcache_entry->xasl_id);
-
-      assert (xcache_entry->n_cache_clones == 0);
     }
   xcache_entry->initialized = false;
   return NO_ERROR;
@@ -996,34 +1043,20 @@ xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, X
     {
       use_xasl_clone = true;
       /* Try to fetch a cached clone. */
-      if ((*xcache_entry)->cache_clones == NULL)
-	{
-	  assert_release (false);
-	  /* Fall through. */
-	}
-      else
+      if (xcache_entry_get_cached_clone (thread_p, *xcache_entry, xclone))
 	{
-	  (void) pthread_mutex_lock (&(*xcache_entry)->cache_clones_mutex);
-	  assert ((*xcache_entry)->n_cache_clones <= xcache_Max_clones);
-	  if ((*xcache_entry)->n_cache_clones > 0)
-	    {
-	      /* A clone is available. */
-	      *xclone = (*xcache_entry)->cache_clones[--(*xcache_entry)->n_cache_clones];
-	      (void) pthread_mutex_unlock (&(*xcache_entry)->cache_clones_mutex);
-
-	      assert (xclone->xasl != NULL && xclone->xasl_buf != NULL);
-
-	      xcache_log ("found cached clone: \n"
-			  XCACHE_LOG_ENTRY_TEXT ("entry")
-			  XCACHE_LOG_XASL_ID_TEXT ("lookup xasl_id")
-			  XCACHE_LOG_CLONE
-			  XCACHE_LOG_TRAN_TEXT,
-			  XCACHE_LOG_ENTRY_ARGS (*xcache_entry),
-			  XCACHE_LOG_XASL_ID_ARGS (xid),
-			  XCACHE_LOG_CLONE_ARGS (xclone), XCACHE_LOG_TRAN_ARGS (thread_p));
-	      return NO_ERROR;
-	    }
-	  (void) pthread_mutex_unlock (&(*xcache_entry)->cache_clones_mutex);
+	  /* A clone is available. */
+	  assert (xclone->xasl != NULL && xclone->xasl_buf != NULL);
+
+	  xcache_log ("found cached clone: \n"
+		      XCACHE_LOG_ENTRY_TEXT ("entry")
+		      XCACHE_LOG_XASL_ID_TEXT ("lookup xasl_id")
+		      XCACHE_LOG_CLONE
+		      XCACHE_LOG_TRAN_TEXT,
+		      XCACHE_LOG_ENTRY_ARGS (*xcache_entry),
+		      XCACHE_LOG_XASL_ID_ARGS (xid),
+		      XCACHE_LOG_CLONE_ARGS (xclone), XCACHE_LOG_TRAN_ARGS (thread_p));
+	  return NO_ERROR;
 	}
       /* Clone not found. */
       /* When clones are activated, we use global heap to generate the XASL's; this way, other threads can use the
@@ -1091,6 +1124,11 @@ xcache_unfix (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
 
   XCACHE_STAT_INC (unfix);
   ATOMIC_INC_64 (&xcache_entry->ref_count, 1);
+  if (xcache_entry->clock_credit != xcache_entry->clock_weight)
+    {
+      /* Refresh CLOCK credit. Avoid writing the shared cache line when credit is already full. */
+      ATOMIC_TAS_32 (&xcache_entry->clock_credit, xcache_entry->clock_weight);
+    }
 
   /* Decrement the number of users. */
   do
@@ -1143,11 +1181,8 @@ xcache_unfix (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
       xcache_log ("delete entry from hash after unfix: \n"
 		  XCACHE_LOG_ENTRY_TEXT ("entry") XCACHE_LOG_TRAN_TEXT,
 		  XCACHE_LOG_ENTRY_ARGS (xcache_entry), XCACHE_LOG_TRAN_ARGS (thread_p));
-      /* No need to acquire the clone mutex, since I'm the unique user. */
-      while (xcache_entry->n_cache_clones > 0)
-	{
-	  xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-	}
+      /* No need to acquire the clone mutexes, since I'm the unique user. */
+      xcache_entry_decache_clones (thread_p, xcache_entry);
 
       if (!xcache_Hashmap.erase (thread_p, xcache_entry->xasl_id))
 	{
@@ -1466,6 +1501,8 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
       (*xcache_entry)->stream = *stream;
       (*xcache_entry)->time_last_rt_check = (INT64) time_stored.tv_sec;
       (*xcache_entry)->time_last_used = time_stored;
+      (*xcache_entry)->clock_weight = xcache_clock_weight (n_oid, stream->buffer_size);
+      (*xcache_entry)->clock_credit = (*xcache_entry)->clock_weight;
 
       /* Now that new entry is initialized, we can try to insert it. */
 
@@ -1625,9 +1662,11 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
     }
   else
     {
+      xcache_clock_add (thread_p, *xcache_entry);
+
       if (xcache_need_cleanup () != XCACHE_CLEANUP_NONE && xcache_Cleanup_flag == 0)
 	{
-	  /* Try to clean up some of the oldest entries. */
+	  /* Evict entries the CLOCK hand finds without credit, or entries unused for a long time. */
 	  xcache_cleanup (thread_p);
 	}
 
@@ -1719,12 +1758,9 @@ xcache_invalidate_entries (THREAD_ENTRY * thread_p, bool (*invalidate_check) (XA
 		{
 		  /*
 		   * Successfully marked for delete. Save it to delete after the iteration.
-		   * No need to acquire the clone mutex, since I'm the unique user.
+		   * No need to acquire the clone mutexes, since I'm the unique user.
 		   */
-		  while (xcache_entry->n_cache_clones > 0)
-		    {
-		      xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-		    }
+		  xcache_entry_decache_clones (thread_p, xcache_entry);
 		  delete_xids[n_delete_xids++] = xcache_entry->xasl_id;
 		}
 	    }
@@ -1883,9 +1919,15 @@ xcache_dump (THREAD_ENTRY * thread_p, FILE * fp)
       fprintf (fp, "  cache flags = %08x \n", xcache_entry->xasl_id.cache_flag & XCACHE_ENTRY_FLAGS_MASK);
       fprintf (fp, "  reference count = %lld \n", (long long) ATOMIC_INC_64 (&xcache_entry->ref_count, 0));
       fprintf (fp, "  time second last used = %lld \n", (long long) xcache_entry->time_last_used.tv_sec);
+      fprintf (fp, "  clock credit = %d (weight = %d) \n", xcache_entry->clock_credit, xcache_entry->clock_weight);
       if (xcache_uses_clones ())
 	{
-	  fprintf (fp, "  clone count = %d \n", xcache_entry->n_cache_clones);
+	  int n_clones = 0;
+	  for (int pool_index = 0; pool_index < XCACHE_CLONE_POOL_COUNT; pool_index++)
+	    {
+	      n_clones += xcache_entry->clone_pools[pool_index].n_clones;
+	    }
+	  fprintf (fp, "  clone count = %d \n", n_clones);
 	}
       fprintf (fp, "  sql info: \n");
 
@@ -1952,6 +1994,147 @@ xcache_clone_decache (THREAD_ENTRY * thread_p, XASL_CLONE * xclone)
   (void) db_change_private_heap (thread_p, save_heapid);
 }
 
+/*
+ * xcache_clone_pool_max_clones () - Get the maximum number of clones that can be cached in a clone pool.
+ *
+ * return	   : Maximum number of clones.
+ * pool_index (in) : Clone pool index.
+ *
+ * NOTE: xcache_Max_clones is spread over the pools of an entry; the first pools get the remainder.
+ */
+static int
+xcache_clone_pool_max_clones (int pool_index)
+{
+  return (xcache_Max_clones / XCACHE_CLONE_POOL_COUNT
+	  + (pool_index < xcache_Max_clones % XCACHE_CLONE_POOL_COUNT ? 1 : 0));
+}
+
+/*
+ * xcache_entry_get_cached_clone () - Get a cached clone of XASL cache entry.
+ *
+ * return	     : True if a cached clone was found.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry.
+ * xclone (out)	     : XASL clone.
+ *
+ * NOTE: The pool of current thread is checked first. Other pools are only checked if their mutex is free; a thread
+ *	 never waits for other threads to fetch clones.
+ */
+static bool
+xcache_entry_get_cached_clone (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, XASL_CLONE * xclone)
+{
+  int own_pool_index = thread_get_entry_index (thread_p) % XCACHE_CLONE_POOL_COUNT;
+  int pool_index;
+  int i;
+  XCACHE_CLONE_POOL *pool;
+
+  for (i = 0; i < XCACHE_CLONE_POOL_COUNT; i++)
+    {
+      pool_index = (own_pool_index + i) % XCACHE_CLONE_POOL_COUNT;
+      pool = &xcache_entry->clone_pools[pool_index];
+
+      if (i == 0)
+	{
+	  (void) pthread_mutex_lock (&pool->mutex);
+	}
+      else if (pool->n_clones == 0 || pthread_mutex_trylock (&pool->mutex) != 0)
+	{
+	  continue;
+	}
+
+      assert (pool->n_clones <= xcache_clone_pool_max_clones (pool_index));
+      if (pool->n_clones > 0)
+	{
+	  *xclone = pool->clones[--pool->n_clones];
+	  (void) pthread_mutex_unlock (&pool->mutex);
+	  return true;
+	}
+      (void) pthread_mutex_unlock (&pool->mutex);
+    }
+
+  return false;
+}
+
+/*
+ * xcache_clone_pool_push () - Cache XASL clone in clone pool. Caller must hold the pool mutex.
+ *
+ * return	   : True if clone was cached, false if there is no room for it.
+ * pool (in)	   : Clone pool.
+ * pool_index (in) : Clone pool index.
+ * xclone (in)	   : XASL clone.
+ */
+static bool
+xcache_clone_pool_push (XCACHE_CLONE_POOL * pool, int pool_index, XASL_CLONE * xclone)
+{
+  int max_clones = xcache_clone_pool_max_clones (pool_index);
+
+  if (pool->n_clones >= max_clones)
+    {
+      /* No more room. */
+      return false;
+    }
+
+  if (pool->n_clones == pool->capacity)
+    {
+      /* Extend cache clone buffer. */
+      XASL_CLONE *new_clones = NULL;
+      int new_capacity = MIN (max_clones, pool->capacity * 2);
+      if (pool->clones == &pool->one_clone)
+	{
+	  assert (pool->capacity == 1);
+	  new_clones = (XASL_CLONE *) malloc (new_capacity * sizeof (XASL_CLONE));
+	  if (new_clones != NULL)
+	    {
+	      new_clones[0].xasl = pool->clones[0].xasl;
+	      new_clones[0].xasl_buf = pool->clones[0].xasl_buf;
+	    }
+	}
+      else
+	{
+	  new_clones = (XASL_CLONE *) realloc (pool->clones, new_capacity * sizeof (XASL_CLONE));
+	}
+      if (new_clones == NULL)
+	{
+	  /* Out of memory? */
+	  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  new_capacity * sizeof (XASL_CLONE));
+	  assert (false);
+	  return false;
+	}
+      pool->clones = new_clones;
+      pool->capacity = new_capacity;
+    }
+  assert (pool->capacity > pool->n_clones);
+  pool->clones[pool->n_clones++] = *xclone;
+  return true;
+}
+
+/*
+ * xcache_entry_decache_clones () - Free all cached clones of XASL cache entry.
+ *
+ * return	     : Void.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry.
+ *
+ * NOTE: Pool mutexes are not acquired; caller must be the unique user of the entry.
+ */
+static void
+xcache_entry_decache_clones (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
+{
+  XCACHE_CLONE_POOL *pool;
+
+  for (int pool_index = 0; pool_index < XCACHE_CLONE_POOL_COUNT; pool_index++)
+    {
+      pool = &xcache_entry->clone_pools[pool_index];
+      assert (pool->n_clones == 0 || pool->n_clones <= xcache_clone_pool_max_clones (pool_index));
+      assert (pool->n_clones == 0 || pool->clones != NULL);
+      while (pool->n_clones > 0)
+	{
+	  xcache_clone_decache (thread_p, &pool->clones[--pool->n_clones]);
+	}
+    }
+}
+
 /*
  * xcache_retire_clone () - Retire XASL clone. If clones caches are enabled, first try to cache it in xcache_entry.
  *
@@ -1963,58 +2146,42 @@ xcache_clone_decache (THREAD_ENTRY * thread_p, XASL_CLONE * xclone)
 void
 xcache_retire_clone (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, XASL_CLONE * xclone)
 {
+  int own_pool_index;
+  int pool_index;
+  int i;
+  XCACHE_CLONE_POOL *pool;
+  bool cached;
+
   /* Free XASL. Be sure that was already cleared to avoid memory leaks. */
   assert (xclone->xasl->status == XASL_CLEARED || xclone->xasl->status == XASL_INITIALIZED);
 
   if (xcache_uses_clones ())
     {
-      pthread_mutex_lock (&xcache_entry->cache_clones_mutex);
-      if (xcache_entry->n_cache_clones < xcache_Max_clones)
+      /* Return the clone to the pool of current thread. If it is full, try the pools that are not busy. */
+      own_pool_index = thread_get_entry_index (thread_p) % XCACHE_CLONE_POOL_COUNT;
+      for (i = 0; i < XCACHE_CLONE_POOL_COUNT; i++)
 	{
-	  if (xcache_entry->n_cache_clones == xcache_entry->cache_clones_capacity
-	      && xcache_entry->cache_clones_capacity < xcache_Max_clones)
+	  pool_index = (own_pool_index + i) % XCACHE_CLONE_POOL_COUNT;
+	  pool = &xcache_entry->clone_pools[pool_index];
+
+	  if (i == 0)
 	    {
-	      /* Extend cache clone buffer. */
-	      XASL_CLONE *new_clones = NULL;
-	      int new_capacity = MIN (xcache_Max_clones, xcache_entry->cache_clones_capacity * 2);
-	      if (xcache_entry->cache_clones == &xcache_entry->one_clone)
-		{
-		  assert (xcache_entry->cache_clones_capacity == 1);
-		  new_clones = (XASL_CLONE *) malloc (new_capacity * sizeof (XASL_CLONE));
-		  if (new_clones != NULL)
-		    {
-		      new_clones[0].xasl = xcache_entry->cache_clones[0].xasl;
-		      new_clones[0].xasl_buf = xcache_entry->cache_clones[0].xasl_buf;
-		    }
-		}
-	      else
-		{
-		  new_clones = (XASL_CLONE *) realloc (xcache_entry->cache_clones, new_capacity * sizeof (XASL_CLONE));
-		}
-	      if (new_clones == NULL)
-		{
-		  /* Out of memory? */
-		  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
-			  new_capacity * sizeof (XASL_CLONE));
-		  assert (false);
-		  pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
-
-		  /* Free the clone. */
-		  xcache_clone_decache (thread_p, xclone);
-		  return;
-		}
-	      xcache_entry->cache_clones = new_clones;
-	      xcache_entry->cache_clones_capacity = new_capacity;
+	      (void) pthread_mutex_lock (&pool->mutex);
+	    }
+	  else if (pthread_mutex_trylock (&pool->mutex) != 0)
+	    {
+	      continue;
 	    }
-	  assert (xcache_entry->cache_clones_capacity > xcache_entry->n_cache_clones);
-	  xcache_entry->cache_clones[xcache_entry->n_cache_clones++] = *xclone;
-	  pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
+	  cached = xcache_clone_pool_push (pool, pool_index, xclone);
+	  (void) pthread_mutex_unlock (&pool->mutex);
 
-	  xclone->xasl = NULL;
-	  xclone->xasl_buf = NULL;
-	  return;
+	  if (cached)
+	    {
+	      xclone->xasl = NULL;
+	      xclone->xasl_buf = NULL;
+	      return;
+	    }
 	}
-      pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
 
       /* No more room. */
       xcache_clone_decache (thread_p, xclone);
@@ -2026,7 +2193,7 @@ xcache_retire_clone (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, X
 }
 
 /*
- * xcache_cleanup () - Cleanup xasl cache when soft capacity is exceeded.
+ * xcache_cleanup () - Cleanup xasl cache when soft capacity is exceeded or when entries were not used for a long time.
  *
  * return	 : Void.
  * thread_p (in) : Thread entry.
@@ -2036,16 +2203,13 @@ xcache_cleanup (THREAD_ENTRY * thread_p)
 {
   assert (xcache_Enabled);
 
-  xcache_hashmap_iterator iter = { thread_p, xcache_Hashmap };
   XASL_CACHE_ENTRY *xcache_entry = NULL;
   XCACHE_CLEANUP_CANDIDATE candidate;
   struct timeval current_time;
   int need_cleanup;
   int candidate_index;
   int count;
-  int cleanup_count;
-  BINARY_HEAP *bh = NULL;
-  int save_max_capacity = 0;
+  int evict_count;
 
   /* We can allow only one cleanup process at a time. There is no point in duplicating this work. Therefore, anyone
    * trying to do the cleanup should first try to set xcache_Cleanup_flag. */
@@ -2071,75 +2235,19 @@ xcache_cleanup (THREAD_ENTRY * thread_p)
 
   if (need_cleanup == XCACHE_CLEANUP_FULL)	/* cleanup because there are too many entries */
     {
-      cleanup_count = (int) (XCACHE_CLEANUP_RATIO * xcache_Soft_capacity) + (xcache_Entry_count - xcache_Soft_capacity);
-      /* Start cleanup. */
+      /* Evict the excess and a small batch, so the next inserts do not have to sweep again. The sweep is bounded;
+       * if the hand did not find enough victims, next insert continues from where it stopped. */
       perfmon_inc_stat (thread_p, PSTAT_PC_NUM_FULL);
 
-      if (cleanup_count <= 0)
-	{
-	  /* Not enough to cleanup */
-	  if (!ATOMIC_CAS_32 (&xcache_Cleanup_flag, 1, 0))
-	    {
-	      assert_release (false);
-	    }
-	  return;
-	}
-      /* Can we use preallocated binary heap? */
-      if (cleanup_count <= xcache_Cleanup_bh->max_capacity)
-	{
-	  bh = xcache_Cleanup_bh;
-	  /* Hack binary heap max capacity to the desired cleanup count. */
-	  save_max_capacity = bh->max_capacity;
-	  bh->max_capacity = cleanup_count;
-	}
-      else
-	{
-	  /* We need a larger binary heap. */
-	  bh =
-	    bh_create (thread_p, cleanup_count, sizeof (XCACHE_CLEANUP_CANDIDATE), xcache_compare_cleanup_candidates,
-		       NULL);
-	  if (bh == NULL)
-	    {
-	      /* Not really expected */
-	      assert (false);
-	      if (!ATOMIC_CAS_32 (&xcache_Cleanup_flag, 1, 0))
-		{
-		  assert_release (false);
-		}
-	      return;
-	    }
-	}
-
-      /* The cleanup is a two-step process:
-       * 1. Iterate through hash and select candidates for cleanup. The least recently used entries are sorted into a binary
-       *    heap.
-       *    NOTE: the binary heap does not story references to hash entries; it stores copies from the candidate keys and
-       *    last used timer of course to sort the candidates.
-       * 2. Remove collected candidates from hash. Entries must be unfix and no flags must be set.
-       */
-
-      assert (bh->element_count == 0);
-      bh->element_count = 0;
-
-      /* Collect candidates for cleanup. */
-      while ((xcache_entry = iter.iterate ()) != NULL)
-	{
-	  candidate.xid = xcache_entry->xasl_id;
-	  candidate.time_last_used = xcache_entry->time_last_used;
+      evict_count = (xcache_Entry_count - xcache_Soft_capacity) + XCACHE_CLOCK_EVICT_BATCH (xcache_Soft_capacity);
+      count = xcache_clock_evict (thread_p, evict_count);
 
-	  if (candidate.xid.cache_flag & XCACHE_ENTRY_FLAGS_MASK)
-	    {
-	      /* Either marked for delete or recompile, or already recompiled. Not a valid candidate. */
-	      continue;
-	    }
-
-	  (void) bh_try_insert (bh, &candidate, NULL);
-	}
-
-      count = bh->element_count;
+      xcache_log ("cleanup evicted entries = %d \n" XCACHE_LOG_TRAN_TEXT, count, XCACHE_LOG_TRAN_ARGS (thread_p));
     }
   else
     {
+      xcache_hashmap_iterator iter = { thread_p, xcache_Hashmap };
+
       /* Collect candidates for cleanup. */
       count = 0;
       gettimeofday (&current_time, NULL);
@@ -2157,59 +2265,36 @@ xcache_cleanup (THREAD_ENTRY * thread_p)
 	  xcache_Cleanup_array[count] = candidate;
 	  count++;
 	}
-    }
 
-  xcache_log ("cleanup collected entries = %d \n" XCACHE_LOG_TRAN_TEXT, count, XCACHE_LOG_TRAN_ARGS (thread_p));
+      xcache_log ("cleanup collected entries = %d \n" XCACHE_LOG_TRAN_TEXT, count, XCACHE_LOG_TRAN_ARGS (thread_p));
 
-  /* Remove candidates from cache. */
-  for (candidate_index = 0; candidate_index < count; candidate_index++)
-    {
-      if (need_cleanup == XCACHE_CLEANUP_FULL)	/* binary heap for candidates */
-	{
-	  /* Get candidate at candidate_index. */
-	  bh_element_at (bh, candidate_index, &candidate);
-	}
-      else
+      /* Remove candidates from cache. */
+      for (candidate_index = 0; candidate_index < count; candidate_index++)
 	{
 	  candidate = xcache_Cleanup_array[candidate_index];
-	}
-      /* Set intention to cleanup the entry. */
-      candidate.xid.cache_flag = XCACHE_ENTRY_CLEANUP;
 
-      /* Try delete. Would be better to decache the clones here. For simplicity, since is not an usual case,
-       * clone decache is postponed - is decached when retired list will be cleared.
-       */
-      if (xcache_Hashmap.erase (thread_p, candidate.xid))
-	{
-	  xcache_log ("cleanup: candidate was removed from hash"
-		      XCACHE_LOG_XASL_ID_TEXT ("xasl id") XCACHE_LOG_TRAN_TEXT,
-		      XCACHE_LOG_XASL_ID_ARGS (&candidate.xid), XCACHE_LOG_TRAN_ARGS (thread_p));
+	  /* Set intention to cleanup the entry. */
+	  candidate.xid.cache_flag = XCACHE_ENTRY_CLEANUP;
 
-	  XCACHE_STAT_INC (deletes_at_cleanup);
-	  perfmon_inc_stat (thread_p, PSTAT_PC_NUM_DELETE);
-	  ATOMIC_INC_32 (&xcache_Entry_count, -1);
-	}
-      else
-	{
-	  xcache_log ("cleanup: candidate was not removed from hash"
-		      XCACHE_LOG_XASL_ID_TEXT ("xasl id") XCACHE_LOG_TRAN_TEXT,
-		      XCACHE_LOG_XASL_ID_ARGS (&candidate.xid), XCACHE_LOG_TRAN_ARGS (thread_p));
-	}
-    }
-  if (need_cleanup == XCACHE_CLEANUP_FULL)
-    {
-      /* Reset binary heap. */
-      bh->element_count = 0;
+	  /* Try delete. Would be better to decache the clones here. For simplicity, since is not an usual case,
+	   * clone decache is postponed - is decached when retired list will be cleared.
+	   */
+	  if (xcache_Hashmap.erase (thread_p, candidate.xid))
+	    {
+	      xcache_log ("cleanup: candidate was removed from hash"
+			  XCACHE_LOG_XASL_ID_TEXT ("xasl id") XCACHE_LOG_TRAN_TEXT,
+			  XCACHE_LOG_XASL_ID_ARGS (&candidate.xid), XCACHE_LOG_TRAN_ARGS (thread_p));
 
-      if (bh != xcache_Cleanup_bh)
-	{
-	  /* Destroy bh */
-	  bh_destroy (thread_p, bh);
-	}
-      else
-	{
-	  /* Reset binary heap max capacity. */
-	  xcache_Cleanup_bh->max_capacity = save_max_capacity;
+	      XCACHE_STAT_INC (deletes_at_cleanup);
+	      perfmon_inc_stat (thread_p, PSTAT_PC_NUM_DELETE);
+	      ATOMIC_INC_32 (&xcache_Entry_count, -1);
+	    }
+	  else
+	    {
+	      xcache_log ("cleanup: candidate was not removed from hash"
+			  XCACHE_LOG_XASL_ID_TEXT ("xasl id") XCACHE_LOG_TRAN_TEXT,
+			  XCACHE_LOG_XASL_ID_ARGS (&candidate.xid), XCACHE_LOG_TRAN_ARGS (thread_p));
+	    }
 	}
     }
 
@@ -2226,36 +2311,154 @@ xcache_cleanup (THREAD_ENTRY * thread_p)
 }
 
 /*
- * xcache_compare_cleanup_candidates () - Compare cleanup candidates by their time_last_used. Oldest candidates are
- *					  considered "greater".
+ * xcache_clock_weight () - Get the CLOCK credit an entry receives each time it is used.
+ *
+ * return		  : CLOCK credit.
+ * n_related_objects (in) : Number of objects related to entry.
+ * stream_size (in)	  : XASL stream size.
  *
- * return	   : BH_CMP_RESULT:
- *		     BH_GT if left is older.
- *		     BH_LT if right is older.
- *		     BH_EQ if left and right are equal.
- * left (in)	   : Left XCACHE cleanup candidate.
- * right (in)	   : Right XCACHE cleanup candidate.
- * ignore_arg (in) : Ignored.
+ * NOTE: Compile time is not known on server; the number of related objects (classes joined and serials) is used as
+ *	 compile cost estimate. Large XASL streams hold more memory and receive half the credit, so that a large plan
+ *	 has to be reused more often than a small plan of same cost to stay cached.
  */
-static BH_CMP_RESULT
-xcache_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_ARG ignore_arg)
+static INT32
+xcache_clock_weight (int n_related_objects, int stream_size)
 {
-  struct timeval left_timeval = ((XCACHE_CLEANUP_CANDIDATE *) left)->time_last_used;
-  struct timeval right_timeval = ((XCACHE_CLEANUP_CANDIDATE *) right)->time_last_used;
+  INT32 weight = 1 + MIN (n_related_objects, XCACHE_CLOCK_MAX_COST_CREDIT);
 
-  /* Lesser means placed in binary heap. So return BH_LT for older timeval. */
-  if (left_timeval.tv_sec < right_timeval.tv_sec)
+  if (stream_size > XCACHE_CLOCK_LARGE_STREAM_SIZE)
     {
-      return BH_LT;
+      weight = MAX (weight / 2, 1);
     }
-  else if (left_timeval.tv_sec == right_timeval.tv_sec)
+  return weight;
+}
+
+/*
+ * xcache_clock_slot_is_valid () - Check CLOCK slot still tracks a cached entry.
+ *
+ * return    : True if slot entry is still in cache.
+ * slot (in) : CLOCK slot.
+ *
+ * NOTE: Entry is read without fixing it; since the entry memory is never freed while the cache is enabled, the worst
+ *	 that can happen is to see a recycled entry, which does not match the key copy of the slot.
+ */
+static bool
+xcache_clock_slot_is_valid (XCACHE_CLOCK_SLOT * slot)
+{
+  return (slot->entry != NULL && XASL_ID_EQ (&slot->entry->xasl_id, &slot->xid)
+	  && !(slot->entry->xasl_id.cache_flag & XCACHE_ENTRY_MARK_DELETED));
+}
+
+/*
+ * xcache_clock_add () - Track a new XASL cache entry in CLOCK ring.
+ *
+ * return	     : Void.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : New XASL cache entry (fixed by caller).
+ */
+static void
+xcache_clock_add (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
+{
+  XCACHE_CLOCK_SLOT *slot;
+  int slot_index;
+  int step;
+
+  (void) pthread_mutex_lock (&xcache_Clock_mutex);
+
+  /* Slots are freed by the hand and by entries being removed from cache. The ring is twice the soft capacity, so a
+   * free slot is usually found after a few steps. */
+  slot_index = xcache_Clock_next_free;
+  for (step = 0; step < xcache_Clock_ring_size; step++)
     {
-      return BH_EQ;
+      slot = &xcache_Clock_ring[slot_index];
+      slot_index = (slot_index + 1) % xcache_Clock_ring_size;
+
+      if (slot->entry == NULL || !xcache_clock_slot_is_valid (slot))
+	{
+	  slot->entry = xcache_entry;
+	  slot->xid = xcache_entry->xasl_id;
+	  xcache_Clock_next_free = slot_index;
+	  (void) pthread_mutex_unlock (&xcache_Clock_mutex);
+	  return;
+	}
     }
-  else
+
+  (void) pthread_mutex_unlock (&xcache_Clock_mutex);
+
+  /* Ring is full. The entry is not tracked; it can still be removed when not used for a long time. */
+  xcache_log ("clock ring is full, entry is not tracked: \n"
+	      XCACHE_LOG_ENTRY_TEXT ("entry") XCACHE_LOG_TRAN_TEXT,
+	      XCACHE_LOG_ENTRY_ARGS (xcache_entry), XCACHE_LOG_TRAN_ARGS (thread_p));
+}
+
+/*
+ * xcache_clock_evict () - Advance CLOCK hand and evict entries without credit.
+ *
+ * return	    : Number of evicted entries.
+ * thread_p (in)    : Thread entry.
+ * evict_count (in) : Desired number of evicted entries.
+ *
+ * NOTE: The hand takes one credit from each unused entry it passes and removes entries that have no credit left.
+ *	 Fixed entries are skipped. At most XCACHE_CLOCK_SWEEP_MAX_STEPS slots are visited per call.
+ */
+static int
+xcache_clock_evict (THREAD_ENTRY * thread_p, int evict_count)
+{
+  XCACHE_CLOCK_SLOT *slot;
+  XASL_ID xid;
+  int n_evicted = 0;
+  int step;
+
+  (void) pthread_mutex_lock (&xcache_Clock_mutex);
+
+  for (step = 0; step < XCACHE_CLOCK_SWEEP_MAX_STEPS && n_evicted < evict_count; step++)
     {
-      return BH_GT;
+      slot = &xcache_Clock_ring[xcache_Clock_hand];
+      xcache_Clock_hand = (xcache_Clock_hand + 1) % xcache_Clock_ring_size;
+
+      if (slot->entry == NULL)
+	{
+	  continue;
+	}
+      if (!xcache_clock_slot_is_valid (slot))
+	{
+	  /* Entry was removed from cache. */
+	  slot->entry = NULL;
+	  continue;
+	}
+      if (slot->entry->xasl_id.cache_flag != 0)
+	{
+	  /* In use, or marked for delete or recompile. */
+	  continue;
+	}
+      if (slot->entry->clock_credit > 0)
+	{
+	  /* Only the hand decrements credits; users just refresh them. */
+	  ATOMIC_INC_32 (&slot->entry->clock_credit, -1);
+	  continue;
+	}
+
+      /* No credit left. Set intention to cleanup the entry; removal fails if somebody fixed it meanwhile. */
+      xid = slot->xid;
+      xid.cache_flag = XCACHE_ENTRY_CLEANUP;
+      if (xcache_Hashmap.erase (thread_p, xid))
+	{
+	  xcache_log ("cleanup: clock victim was removed from hash"
+		      XCACHE_LOG_XASL_ID_TEXT ("xasl id") XCACHE_LOG_TRAN_TEXT,
+		      XCACHE_LOG_XASL_ID_ARGS (&xid), XCACHE_LOG_TRAN_ARGS (thread_p));
+
+	  XCACHE_STAT_INC (deletes_at_cleanup);
+	  perfmon_inc_stat (thread_p, PSTAT_PC_NUM_DELETE);
+	  ATOMIC_INC_32 (&xcache_Entry_count, -1);
+
+	  slot->entry = NULL;
+	  n_evicted++;
+	}
     }
+
+  (void) pthread_mutex_unlock (&xcache_Clock_mutex);
+
+  return n_evicted;
 }
 
 /*
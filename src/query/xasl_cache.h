@@ -85,6 +85,20 @@ struct execution_info
 #define EXEINFO_AS_ARGS(einfo)	\
   EXEINFO_USER_TEXT_STRING(einfo), EXEINFO_PLAN_TEXT_STRING(einfo), EXEINFO_HASH_TEXT_STRING(einfo)
 
+/* Cached XASL clones of an entry are spread over several pools. Each thread uses the pool selected by its index, so
+ * that concurrent executions of the same hot entry do not all serialize on one mutex. */
+#define XCACHE_CLONE_POOL_COUNT 4
+
+typedef struct xcache_clone_pool XCACHE_CLONE_POOL;
+struct xcache_clone_pool
+{
+  XASL_CLONE *clones;
+  XASL_CLONE one_clone;
+  int n_clones;
+  int capacity;
+  pthread_mutex_t mutex;
+};
+
 /* This really belongs more to the query manager rather than query executor. */
 /* XASL cache entry type definition */
 typedef struct xasl_cache_ent XASL_CACHE_ENTRY;
@@ -116,11 +130,11 @@ struct xasl_cache_ent
   bool free_data_on_uninit;	/* set to free entry data on uninit. */
 
   /* Cache clones */
-  XASL_CLONE *cache_clones;
-  XASL_CLONE one_clone;
-  int n_cache_clones;
-  int cache_clones_capacity;
-  pthread_mutex_t cache_clones_mutex;
+  XCACHE_CLONE_POOL clone_pools[XCACHE_CLONE_POOL_COUNT];
+
+  /* CLOCK eviction */
+  volatile INT32 clock_credit;	/* sweeps the entry survives unused; refreshed each time the entry is used */
+  INT32 clock_weight;		/* credit given on each use, derived from compile cost and XASL stream size */
 
   /* RT check */
   INT64 time_last_rt_check;
@@ -818,6 +818,24 @@ session_check_session (THREAD_ENTRY * thread_p, const SESSION_ID id)
 #endif /* SESSION_DEBUG */
 
 #if defined (SERVER_MODE)
+  if (thread_p && thread_p->conn_entry && thread_p->conn_entry->session_p
+      && thread_p->conn_entry->session_id == id)
+    {
+      /* The connection already references this session. It holds a reference count and sessions with an active
+       * connection are never expired, so there is no need to go through the hash map. */
+      session_p = thread_p->conn_entry->session_p;
+      assert (session_p->id == id);
+
+      pthread_mutex_lock (&session_p->mutex);
+      session_p->active_time = time (NULL);
+      pthread_mutex_unlock (&session_p->mutex);
+
+      session_set_conn_entry_data (thread_p, session_p);
+      logtb_set_current_user_active (thread_p, true);
+
+      return NO_ERROR;
+    }
+
   if (thread_p && thread_p->conn_entry && thread_p->conn_entry->session_p)
     {
       SESSION_ID old_id = thread_p->conn_entry->session_id;
@@ -93,7 +93,7 @@ struct disk_volume_header
 				 * log. The value is generated by the log manager */
   LOG_LSA chkpt_lsa;		/* Lowest log sequence address to start the recovery process of this volume */
   HFID boot_hfid;		/* System Heap file for booting purposes and multi volumes */
-  INT32 reserved0;		/* reserved area */
+  INT32 format_flags;		/* DISK_FORMAT_* flags of the database, the same in all volumes */
   INT32 reserved1;		/* reserved area */
   INT32 reserved2;		/* reserved area */
   INT32 reserved3;		/* reserved area */
@@ -188,6 +188,18 @@ struct disk_temp_info
   DKNSECTS nsect_perm_total;
 };
 
+/* Temporary sectors reserved ahead, so that temporary files are created and extended without reserving sectors from
+ * disk cache and volumes every time. Threads are spread over pools by their index. */
+#define DISK_TEMP_POOL_COUNT 16
+
+typedef struct disk_temp_sector_pool DISK_TEMP_SECTOR_POOL;
+struct disk_temp_sector_pool
+{
+  pthread_mutex_t mutex;
+  int nsects;			/* number of sectors in pool */
+  VSID *vsids;			/* pooled sectors; room for two times the pool size */
+};
+
 typedef struct disk_cache DISK_CACHE;
 struct disk_cache
 {
@@ -202,6 +214,11 @@ struct disk_cache
 #if !defined (NDEBUG)
   volatile int owner_extend;
 #endif				/* !NDEBUG */
+
+  /* note: pool mutex may be held while reserving sectors from disk, never the other way around */
+  DISK_TEMP_SECTOR_POOL temp_pools[DISK_TEMP_POOL_COUNT];
+  int temp_pool_size;		/* sectors a pool keeps; 0 if pools are not used */
+  VSID *temp_pools_vsids;	/* memory of all pools */
 };
 
 static DISK_CACHE *disk_Cache = NULL;
@@ -301,6 +318,12 @@ struct disk_reserve_context
 #define DISK_SAFE_OSDISK_FREE_SPACE (64 * 1024 * 1024)
 #define DISK_SAFE_OSDISK_FREE_SECTS (DISK_SAFE_OSDISK_FREE_SPACE / IO_SECTORSIZE)
 
+/* Database format flags. They are set when the first volume is formatted and every new volume inherits them. Older
+ * releases keep the field zero. */
+#define DISK_FORMAT_PAGE_CHECKSUM	0x1	/* data pages may carry a checksum */
+
+static INT32 disk_Format_flags = 0;
+
 /************************************************************************/
 /* Utility section                                                      */
 /************************************************************************/
@@ -357,6 +380,8 @@ static int disk_vhdr_set_next_vol_fullname (DISK_VOLUME_HEADER * vhdr, const cha
 static int disk_vhdr_set_vol_remarks (DISK_VOLUME_HEADER * vhdr, const char *vol_remarks);
 
 static bool disk_cache_load_all_volumes (THREAD_ENTRY * thread_p);
+static void disk_set_format_flags (INT32 format_flags);
+static int disk_load_format_flags (THREAD_ENTRY * thread_p);
 static bool disk_cache_load_volume (THREAD_ENTRY * thread_p, INT16 volid, void *ignore);
 
 static const char *disk_purpose_to_string (DISK_VOLPURPOSE purpose);
@@ -422,7 +447,13 @@ STATIC_INLINE void disk_cache_update_vol_free (VOLID volid, DKNSECTS delta_free)
 /* Sector reserve section                                               */
 /************************************************************************/
 
+static int disk_reserve_sectors_internal (THREAD_ENTRY * thread_p, DB_VOLPURPOSE purpose, VOLID volid_hint,
+					  int n_sectors, VSID * reserved_sectors);
 static int disk_reserve_sectors_in_volume (THREAD_ENTRY * thread_p, int vol_index, DISK_RESERVE_CONTEXT * context);
+STATIC_INLINE DISK_TEMP_SECTOR_POOL *disk_temp_pool_get (THREAD_ENTRY * thread_p) __attribute__ ((ALWAYS_INLINE));
+static int disk_temp_pool_reserve (THREAD_ENTRY * thread_p, int n_sectors, VSID * reserved_sectors,
+				   bool * is_reserved);
+static int disk_temp_pool_release (THREAD_ENTRY * thread_p, int nsects, const VSID * vsids);
 static DISK_ISVALID disk_is_sector_reserved (THREAD_ENTRY * thread_p, const DISK_VOLUME_HEADER * volheader,
 					     SECTID sectid, bool debug_crash);
 static int disk_reserve_from_cache (THREAD_ENTRY * thread_p, DISK_RESERVE_CONTEXT * context, bool * did_extend);
@@ -608,7 +639,8 @@ disk_format (THREAD_ENTRY * thread_p, const char *dbname, VOLID volid, DBDEF_VOL
   vhdr->db_charset = lang_charset ();
   vhdr->hint_allocsect = NULL_SECTID;
   vhdr->dummy1 = vhdr->dummy2 = 0;	/* alignment. You may use it. */
-  vhdr->reserved0 = vhdr->reserved1 = vhdr->reserved2 = vhdr->reserved3 = 0;	/* for future extension */
+  vhdr->format_flags = disk_Format_flags;
+  vhdr->reserved1 = vhdr->reserved2 = vhdr->reserved3 = 0;	/* for future extension */
 
   /* set sector table info in volume header */
   disk_volume_header_set_stab (vol_purpose, vhdr);
@@ -2646,6 +2678,29 @@ disk_cache_init (void)
       disk_Cache->vols[i].purpose = DISK_UNKNOWN_PURPOSE;
       disk_Cache->vols[i].nsect_free = 0;
     }
+
+  disk_Cache->temp_pool_size = prm_get_integer_value (PRM_ID_TEMP_FILE_SECTOR_POOL_SIZE);
+  disk_Cache->temp_pools_vsids = NULL;
+  if (disk_Cache->temp_pool_size > 0)
+    {
+      size_t size = DISK_TEMP_POOL_COUNT * 2 * disk_Cache->temp_pool_size * sizeof (VSID);
+
+      disk_Cache->temp_pools_vsids = (VSID *) malloc (size);
+      if (disk_Cache->temp_pools_vsids == NULL)
+	{
+	  /* can do without pools */
+	  er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+	  disk_Cache->temp_pool_size = 0;
+	}
+    }
+  for (i = 0; i < DISK_TEMP_POOL_COUNT; i++)
+    {
+      pthread_mutex_init (&disk_Cache->temp_pools[i].mutex, NULL);
+      disk_Cache->temp_pools[i].nsects = 0;
+      disk_Cache->temp_pools[i].vsids =
+	(disk_Cache->temp_pool_size > 0) ? disk_Cache->temp_pools_vsids + i * 2 * disk_Cache->temp_pool_size : NULL;
+    }
+
   return NO_ERROR;
 }
 
@@ -2655,6 +2710,8 @@ disk_cache_init (void)
 static void
 disk_cache_final (void)
 {
+  int i;
+
   if (disk_Cache == NULL)
     {
       /* not initialized */
@@ -2669,6 +2726,16 @@ disk_cache_final (void)
   pthread_mutex_destroy (&disk_Cache->temp_purpose_info.extend_info.mutex_reserve);
   pthread_mutex_destroy (&disk_Cache->mutex_extend);
 
+  /* pooled sectors belong to temporary volumes and temporary purpose volumes, which are reset anyway */
+  for (i = 0; i < DISK_TEMP_POOL_COUNT; i++)
+    {
+      pthread_mutex_destroy (&disk_Cache->temp_pools[i].mutex);
+    }
+  if (disk_Cache->temp_pools_vsids != NULL)
+    {
+      free_and_init (disk_Cache->temp_pools_vsids);
+    }
+
   free_and_init (disk_Cache);
 }
 
@@ -3119,6 +3186,7 @@ disk_vhdr_dump (FILE * fp, const DISK_VOLUME_HEADER * vhdr)
   (void) fprintf (fp, "Boot_hfid: volid %d, fileid %d header_pageid %d\n", vhdr->boot_hfid.vfid.volid,
 		  vhdr->boot_hfid.vfid.fileid, vhdr->boot_hfid.hpgid);
   (void) fprintf (fp, " db_charset = %d\n", vhdr->db_charset);
+  (void) fprintf (fp, " format_flags = 0x%x\n", vhdr->format_flags);
 }
 
 /*
@@ -4221,6 +4289,139 @@ disk_is_sector_reserved (THREAD_ENTRY * thread_p, const DISK_VOLUME_HEADER * vol
 int
 disk_reserve_sectors (THREAD_ENTRY * thread_p, DB_VOLPURPOSE purpose, VOLID volid_hint, int n_sectors,
 		      VSID * reserved_sectors)
+{
+  bool is_reserved = false;
+  int error_code = NO_ERROR;
+
+  if (purpose == DB_TEMPORARY_DATA_PURPOSE && n_sectors > 0 && reserved_sectors != NULL)
+    {
+      error_code = disk_temp_pool_reserve (thread_p, n_sectors, reserved_sectors, &is_reserved);
+      if (error_code != NO_ERROR || is_reserved)
+	{
+	  return error_code;
+	}
+    }
+
+  return disk_reserve_sectors_internal (thread_p, purpose, volid_hint, n_sectors, reserved_sectors);
+}
+
+/*
+ * disk_temp_pool_get () - Get the temporary sectors pool of thread.
+ *
+ * return	 : Temporary sectors pool.
+ * thread_p (in) : Thread entry.
+ */
+STATIC_INLINE DISK_TEMP_SECTOR_POOL *
+disk_temp_pool_get (THREAD_ENTRY * thread_p)
+{
+  return &disk_Cache->temp_pools[thread_get_entry_index (thread_p) % DISK_TEMP_POOL_COUNT];
+}
+
+/*
+ * disk_temp_pool_reserve () - Reserve temporary sectors from the pool of thread. When the pool does not have enough
+ *			       sectors, it is refilled with a batch of sectors reserved from disk.
+ *
+ * return		  : Error code.
+ * thread_p (in)	  : Thread entry.
+ * n_sectors (in)	  : Number of sectors to reserve.
+ * reserved_sectors (out) : Array of reserved sectors.
+ * is_reserved (out)	  : True if sectors were reserved from pool, false if they must be reserved from disk.
+ */
+static int
+disk_temp_pool_reserve (THREAD_ENTRY * thread_p, int n_sectors, VSID * reserved_sectors, bool * is_reserved)
+{
+  DISK_TEMP_SECTOR_POOL *pool;
+  int n_refill;
+  int error_code = NO_ERROR;
+
+  *is_reserved = false;
+
+  if (n_sectors > disk_Cache->temp_pool_size)
+    {
+      /* pools are not used or too many sectors are required */
+      return NO_ERROR;
+    }
+
+  pool = disk_temp_pool_get (thread_p);
+  pthread_mutex_lock (&pool->mutex);
+
+  if (pool->nsects < n_sectors)
+    {
+      /* refill; pool is left with pool size sectors after this reservation */
+      n_refill = disk_Cache->temp_pool_size + n_sectors - pool->nsects;
+      assert (pool->nsects + n_refill <= 2 * disk_Cache->temp_pool_size);
+
+      error_code = disk_reserve_sectors_internal (thread_p, DB_TEMPORARY_DATA_PURPOSE, NULL_VOLID, n_refill,
+						  pool->vsids + pool->nsects);
+      if (error_code != NO_ERROR)
+	{
+	  /* there may be not enough temporary space for a whole batch; try to reserve only what is required */
+	  pthread_mutex_unlock (&pool->mutex);
+	  er_clear ();
+	  return NO_ERROR;
+	}
+      pool->nsects += n_refill;
+
+      disk_log ("disk_temp_pool_reserve", "refill temporary sectors pool %d with %d sectors.",
+		(int) (pool - disk_Cache->temp_pools), n_refill);
+    }
+
+  pool->nsects -= n_sectors;
+  memcpy (reserved_sectors, pool->vsids + pool->nsects, n_sectors * sizeof (VSID));
+
+  pthread_mutex_unlock (&pool->mutex);
+
+  *is_reserved = true;
+  return NO_ERROR;
+}
+
+/*
+ * disk_temp_pool_release () - Keep unreserved temporary sectors in the pool of thread, up to pool size.
+ *
+ * return	 : Number of sectors kept in pool, from the start of the array.
+ * thread_p (in) : Thread entry.
+ * nsects (in)	 : Number of sectors.
+ * vsids (in)	 : Array of sectors.
+ */
+static int
+disk_temp_pool_release (THREAD_ENTRY * thread_p, int nsects, const VSID * vsids)
+{
+  DISK_TEMP_SECTOR_POOL *pool;
+  int n_keep;
+
+  if (disk_Cache->temp_pool_size == 0)
+    {
+      return 0;
+    }
+
+  pool = disk_temp_pool_get (thread_p);
+  pthread_mutex_lock (&pool->mutex);
+
+  n_keep = MIN (nsects, disk_Cache->temp_pool_size - pool->nsects);
+  if (n_keep > 0)
+    {
+      memcpy (pool->vsids + pool->nsects, vsids, n_keep * sizeof (VSID));
+      pool->nsects += n_keep;
+    }
+
+  pthread_mutex_unlock (&pool->mutex);
+
+  return MAX (n_keep, 0);
+}
+
+/*
+ * disk_reserve_sectors_internal () - Reserve the required number of sectors in all database volumes.
+ *
+ * return		  : Error code.
+ * thread_p (in)	  : Thread entry.
+ * purpose (in)		  : Reservations purpose (data, index, generic or temp).
+ * volid_hint (in)	  : Hint a volume to be checked first.
+ * n_sectors (in)	  : Number of sectors to reserve.
+ * reserved_sectors (out) : Array of reserved sectors.
+ */
+static int
+disk_reserve_sectors_internal (THREAD_ENTRY * thread_p, DB_VOLPURPOSE purpose, VOLID volid_hint, int n_sectors,
+			       VSID * reserved_sectors)
 {
   int iter;
   DISK_RESERVE_CONTEXT context;
@@ -4634,8 +4835,22 @@ disk_reserve_from_cache_volume (VOLID volid, DISK_RESERVE_CONTEXT * context)
 int
 disk_unreserve_ordered_sectors (THREAD_ENTRY * thread_p, DB_VOLPURPOSE purpose, int nsects, VSID * vsids)
 {
+  int n_pooled;
   int error_code = NO_ERROR;
 
+  if (purpose == DB_TEMPORARY_DATA_PURPOSE)
+    {
+      /* keep some for next temporary reservations */
+      n_pooled = disk_temp_pool_release (thread_p, nsects, vsids);
+      if (n_pooled == nsects)
+	{
+	  return NO_ERROR;
+	}
+      /* the rest are still ordered */
+      nsects -= n_pooled;
+      vsids += n_pooled;
+    }
+
   error_code = csect_enter_as_reader (thread_p, CSECT_DISK_CHECK, INF_WAIT);
   if (error_code != NO_ERROR)
     {
@@ -4967,6 +5182,17 @@ disk_manager_init (THREAD_ENTRY * thread_p, bool load_from_disk)
       return error_code;
     }
 
+  if (load_from_disk)
+    {
+      error_code = disk_load_format_flags (thread_p);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  disk_manager_final ();
+	  return error_code;
+	}
+    }
+
 #if defined (SERVER_MODE)
   disk_auto_volume_expansion_daemon_init ();
 #endif /* SERVER_MODE */
@@ -4987,6 +5213,49 @@ disk_manager_final (void)
   disk_cache_final ();
 }
 
+/*
+ * disk_set_format_flags () - set the format flags of the database
+ *
+ * return            : void
+ * format_flags (in) : format flags
+ *
+ * note: page checksums are written only if the database format allows them, so that databases created by older
+ *       releases keep pages they can read. data_page_checksum can still turn them off.
+ */
+static void
+disk_set_format_flags (INT32 format_flags)
+{
+  disk_Format_flags = format_flags;
+  fileio_enable_page_checksum ((format_flags & DISK_FORMAT_PAGE_CHECKSUM) != 0
+			       && prm_get_bool_value (PRM_ID_DATA_PAGE_CHECKSUM));
+}
+
+/*
+ * disk_load_format_flags () - load the format flags of the database from the first volume header
+ *
+ * return        : error code
+ * thread_p (in) : thread entry
+ */
+static int
+disk_load_format_flags (THREAD_ENTRY * thread_p)
+{
+  PAGE_PTR page_volheader = NULL;
+  DISK_VOLUME_HEADER *volheader;
+  int error_code = NO_ERROR;
+
+  error_code = disk_get_volheader (thread_p, LOG_DBFIRST_VOLID, PGBUF_LATCH_READ, &page_volheader, &volheader);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  disk_set_format_flags (volheader->format_flags);
+
+  pgbuf_unfix (thread_p, page_volheader);
+  return NO_ERROR;
+}
+
 /*
  * disk_format_first_volume () - format first database volume
  *
@@ -5025,6 +5294,9 @@ disk_format_first_volume (THREAD_ENTRY * thread_p, const char *full_dbname, cons
   disk_Cache->nvols_perm = 1;
   disk_Cache->vols[LOG_DBFIRST_VOLID].purpose = DB_PERMANENT_DATA_PURPOSE;
 
+  /* the format of a new database is decided here; the volumes added later inherit it */
+  disk_set_format_flags (prm_get_bool_value (PRM_ID_DATA_PAGE_CHECKSUM) ? DISK_FORMAT_PAGE_CHECKSUM : 0);
+
   error_code = disk_format (thread_p, full_dbname, LOG_DBFIRST_VOLID, &ext_info, &nsect_free);
   if (error_code != NO_ERROR)
     {
@@ -25,6 +25,11 @@
 
 #include <assert.h>
 #include <math.h>
+#if defined (SERVER_MODE)
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#endif /* SERVER_MODE */
 
 #include "double_write_buffer.h"
 
@@ -33,6 +38,7 @@
 #include "thread_entry_task.hpp"
 #include "thread_lockfree_hash_map.hpp"
 #include "thread_manager.hpp"
+#include "thread_worker_pool.hpp"
 #include "log_append.hpp"
 #include "log_impl.h"
 #include "log_volids.hpp"
@@ -396,10 +402,103 @@ STATIC_INLINE int dwb_slots_hash_insert (THREAD_ENTRY * thread_p, VPID * vpid, D
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int dwb_slots_hash_delete (THREAD_ENTRY * thread_p, DWB_SLOT * slot);
 
+/* The pages of a volume, written from a block. */
+typedef struct dwb_volume_pages DWB_VOLUME_PAGES;
+struct dwb_volume_pages
+{
+  unsigned int start_slot;	/* The first ordered slot of the volume. */
+  unsigned int end_slot;	/* The ordered slot after the last one of the volume. */
+  FLUSH_VOLUME_INFO *flush_volume_info;	/* The volume flush information. */
+};
+
+#if defined (SERVER_MODE)
+static int dwb_write_volume_pages (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots,
+				   DWB_VOLUME_PAGES * volume_pages, bool file_sync_helper_can_flush);
+#endif /* SERVER_MODE */
+
 // *INDENT-OFF*
 #if defined (SERVER_MODE)
 static cubthread::daemon *dwb_flush_block_daemon = NULL;
 static cubthread::daemon *dwb_file_sync_helper_daemon = NULL;
+static cubthread::entry_workpool *dwb_volume_writers_pool = NULL;
+
+// dwb_volume_writers - the volumes of a block written in parallel. Volume i is written by writer i % count_writers;
+//                      the block writer is writer 0 and waits for the others.
+struct dwb_volume_writers
+{
+  DWB_BLOCK *block;
+  DWB_SLOT *ordered_slots;
+  std::vector<DWB_VOLUME_PAGES> volumes;
+  unsigned int count_writers;
+  bool file_sync_helper_can_flush;
+
+  std::mutex mutex;
+  std::condition_variable cond;
+  unsigned int active_writers;
+  int error_code;
+
+  int write (THREAD_ENTRY * thread_p, unsigned int writer_index);
+  void end_writer (int writer_error_code);
+  int wait_writers ();
+};
+
+// dwb_volume_write_task - writes the volumes of a block assigned to a writer
+class dwb_volume_write_task : public cubthread::entry_task
+{
+  public:
+    dwb_volume_write_task (dwb_volume_writers &writers, unsigned int writer_index)
+      : m_writers (writers)
+      , m_writer_index (writer_index)
+    {
+    }
+
+    void execute (cubthread::entry &thread_ref) override
+    {
+      m_writers.end_writer (m_writers.write (&thread_ref, m_writer_index));
+    }
+
+  private:
+    dwb_volume_writers &m_writers;
+    unsigned int m_writer_index;
+};
+
+int
+dwb_volume_writers::write (THREAD_ENTRY * thread_p, unsigned int writer_index)
+{
+  for (std::size_t i = writer_index; i < volumes.size (); i += count_writers)
+    {
+      int err = dwb_write_volume_pages (thread_p, block, ordered_slots, &volumes[i], file_sync_helper_can_flush);
+      if (err != NO_ERROR)
+        {
+          return err;
+        }
+    }
+  return NO_ERROR;
+}
+
+void
+dwb_volume_writers::end_writer (int writer_error_code)
+{
+  std::unique_lock<std::mutex> ulock (mutex);
+  if (writer_error_code != NO_ERROR && error_code == NO_ERROR)
+    {
+      error_code = writer_error_code;
+    }
+  assert (active_writers > 0);
+  if (--active_writers == 0)
+    {
+      // notify while holding the mutex; the block writer destroys this object as soon as it wakes up
+      cond.notify_all ();
+    }
+}
+
+int
+dwb_volume_writers::wait_writers ()
+{
+  std::unique_lock<std::mutex> ulock (mutex);
+  cond.wait (ulock, [this] { return active_writers == 0; });
+  return error_code;
+}
 #endif
 // *INDENT-ON*
 
@@ -1162,7 +1261,7 @@ dwb_create_internal (THREAD_ENTRY * thread_p, const char *dwb_volume_name, UINT6
 
   double_write_buffer_size = prm_get_integer_value (PRM_ID_DWB_SIZE);
   num_blocks = prm_get_integer_value (PRM_ID_DWB_BLOCKS);
-  if (double_write_buffer_size == 0 || num_blocks == 0)
+  if (double_write_buffer_size == 0 || num_blocks == 0 || dwb_is_bypassed ())
     {
       /* Do not use double write buffer. */
       return NO_ERROR;
@@ -1975,6 +2074,178 @@ dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
   return flush_new_volume_info;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * dwb_write_volume_pages () - Write the block pages of a volume.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * block(in): The block that is written.
+ * p_dwb_ordered_slots(in): The slots that gives the pages flush order.
+ * volume_pages(in): The volume pages to write.
+ * file_sync_helper_can_flush(in): True, if helper can flush.
+ */
+static int
+dwb_write_volume_pages (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots,
+			DWB_VOLUME_PAGES * volume_pages, bool file_sync_helper_can_flush)
+{
+  FLUSH_VOLUME_INFO *flush_volume_info = volume_pages->flush_volume_info;
+  VPID *vpid;
+  unsigned int i;
+
+  assert (flush_volume_info != NULL && flush_volume_info->vdes != NULL_VOLDES);
+
+  for (i = volume_pages->start_slot; i < volume_pages->end_slot; i++)
+    {
+      vpid = &p_dwb_ordered_slots[i].vpid;
+
+      assert (p_dwb_ordered_slots[i].io_page->prv.pflag_reserve_1 == '\0');
+      assert (p_dwb_ordered_slots[i].io_page->prv.p_reserve_3 == 0);
+      assert (vpid->pageid == p_dwb_ordered_slots[i].io_page->prv.pageid
+	      && vpid->volid == p_dwb_ordered_slots[i].io_page->prv.volid);
+
+      if (fileio_write (thread_p, flush_volume_info->vdes, p_dwb_ordered_slots[i].io_page, vpid->pageid, IO_PAGESIZE,
+			FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+	{
+	  ASSERT_ERROR ();
+	  dwb_log_error ("DWB write page VPID=(%d, %d) LSA=(%lld,%d) with %d error: \n",
+			 vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
+			 (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset, er_errid ());
+	  assert (false);
+	  return ER_FAILED;
+	}
+
+      dwb_log ("dwb_write_volume_pages: written page = (%d,%d) LSA=(%lld,%d)\n",
+	       vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
+	       (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset);
+
+      ATOMIC_INC_32 (&flush_volume_info->num_pages, 1);
+    }
+
+  /* The file sync helper may synchronize the volume from now on. Wake it, unless it already works on the block. */
+  flush_volume_info->all_pages_written = true;
+
+  if (file_sync_helper_can_flush && dwb_is_file_sync_helper_daemon_available ()
+      && ATOMIC_CAS_ADDR (&dwb_Global.file_sync_helper_block, (DWB_BLOCK *) NULL, block))
+    {
+      dwb_file_sync_helper_daemon->wakeup ();
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * dwb_write_block_parallel () - Write block pages of different volumes in parallel.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * block(in): The block that is written.
+ * p_dwb_ordered_slots(in): The slots that gives the pages flush order.
+ * file_sync_helper_can_flush(in): True, if helper can flush.
+ * count_writes(out): The number of written pages.
+ * is_written(out): True, if the block pages were written. False, if the block must be written by a single writer.
+ *
+ *  Note: Each volume is written by one writer, in pages order, so the writes of each volume remain sequential.
+ *        The file sync helper is woken as soon as a volume is completely written.
+ */
+STATIC_INLINE int
+dwb_write_block_parallel (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots,
+			  bool file_sync_helper_can_flush, int *count_writes, bool * is_written)
+{
+  DWB_VOLUME_PAGES volume_pages;
+  VPID *vpid;
+  unsigned int i, count_volumes = 0;
+  VOLID last_volid = NULL_VOLID;
+  int vol_fd, error_code;
+
+  *is_written = false;
+  *count_writes = 0;
+
+  if (dwb_volume_writers_pool == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  /* The slots are ordered by VPID, count the volumes first. */
+  for (i = 0; i < block->count_wb_pages; i++)
+    {
+      vpid = &p_dwb_ordered_slots[i].vpid;
+      if (!VPID_ISNULL (vpid) && vpid->volid != last_volid)
+	{
+	  last_volid = vpid->volid;
+	  count_volumes++;
+	}
+    }
+  if (count_volumes < 2)
+    {
+      /* Nothing to parallelize. */
+      return NO_ERROR;
+    }
+
+  /* *INDENT-OFF* */
+  dwb_volume_writers writers;
+  /* *INDENT-ON* */
+
+  writers.block = block;
+  writers.ordered_slots = p_dwb_ordered_slots;
+  writers.file_sync_helper_can_flush = file_sync_helper_can_flush;
+  writers.volumes.reserve (count_volumes);
+
+  for (i = 0; i < block->count_wb_pages; i = volume_pages.end_slot)
+    {
+      vpid = &p_dwb_ordered_slots[i].vpid;
+
+      volume_pages.start_slot = i;
+      volume_pages.end_slot = i + 1;
+      if (VPID_ISNULL (vpid))
+	{
+	  continue;
+	}
+      while (volume_pages.end_slot < block->count_wb_pages
+	     && p_dwb_ordered_slots[volume_pages.end_slot].vpid.volid == vpid->volid)
+	{
+	  volume_pages.end_slot++;
+	}
+
+      vol_fd = fileio_get_volume_descriptor (vpid->volid);
+      if (vol_fd == NULL_VOLDES)
+	{
+	  /* probably it was removed meanwhile. skip it! */
+	  continue;
+	}
+
+      volume_pages.flush_volume_info = dwb_add_volume_to_block_flush_area (thread_p, block, vol_fd);
+      writers.volumes.push_back (volume_pages);
+      *count_writes += (int) (volume_pages.end_slot - volume_pages.start_slot);
+    }
+
+  if (writers.volumes.empty ())
+    {
+      /* All volumes were removed meanwhile. */
+      *is_written = true;
+      return NO_ERROR;
+    }
+
+  writers.count_writers = (unsigned int) MIN (writers.volumes.size (), dwb_volume_writers_pool->get_max_count () + 1);
+  writers.active_writers = writers.count_writers;
+  writers.error_code = NO_ERROR;
+
+  for (i = 1; i < writers.count_writers; i++)
+    {
+      /* *INDENT-OFF* */
+      cubthread::get_manager ()->push_task (dwb_volume_writers_pool, new dwb_volume_write_task (writers, i));
+      /* *INDENT-ON* */
+    }
+
+  writers.end_writer (writers.write (thread_p, 0));
+  error_code = writers.wait_writers ();
+
+  *is_written = true;
+
+  return error_code;
+}
+#endif /* SERVER_MODE */
+
 /*
  * dwb_write_block () - Write block pages in specified order.
  *
@@ -2000,6 +2271,7 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   int count_writes = 0, num_pages_to_sync;
   FLUSH_VOLUME_INFO *current_flush_volume_info = NULL;
   bool can_flush_volume = false;
+  bool is_written = false;
 
   assert (block != NULL && p_dwb_ordered_slots != NULL);
 
@@ -2017,7 +2289,17 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   last_written_volid = NULL_VOLID;
   last_written_vol_fd = NULL_VOLDES;
 
-  for (i = 0; i < block->count_wb_pages; i++)
+#if defined (SERVER_MODE)
+  /* Pages of different volumes are written by several writers, if possible. */
+  error_code = dwb_write_block_parallel (thread_p, block, p_dwb_ordered_slots, file_sync_helper_can_flush,
+					&count_writes, &is_written);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+#endif
+
+  for (i = 0; !is_written && i < block->count_wb_pages; i++)
     {
       vpid = &p_dwb_ordered_slots[i].vpid;
       if (VPID_ISNULL (vpid))
@@ -2055,7 +2337,6 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
       assert (last_written_vol_fd != NULL_VOLDES);
 
       assert (p_dwb_ordered_slots[i].io_page->prv.pflag_reserve_1 == '\0');
-      assert (p_dwb_ordered_slots[i].io_page->prv.p_reserve_2 == 0);
       assert (p_dwb_ordered_slots[i].io_page->prv.p_reserve_3 == 0);
       assert (p_dwb_ordered_slots[i].vpid.pageid == p_dwb_ordered_slots[i].io_page->prv.pageid
 	      && p_dwb_ordered_slots[i].vpid.volid == p_dwb_ordered_slots[i].io_page->prv.volid);
@@ -2215,7 +2496,6 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
       s2 = &p_dwb_ordered_slots[i + 1];
 
       assert (s1->io_page->prv.pflag_reserve_1 == '\0');
-      assert (s1->io_page->prv.p_reserve_2 == 0);
       assert (s1->io_page->prv.p_reserve_3 == 0);
 
       if (!VPID_ISNULL (&s1->vpid) && VPID_EQ (&s1->vpid, &s2->vpid))
@@ -2593,7 +2873,6 @@ dwb_set_slot_data (THREAD_ENTRY * thread_p, DWB_SLOT * dwb_slot, FILEIO_PAGE * i
   assert (dwb_slot != NULL && io_page_p != NULL);
 
   assert (io_page_p->prv.pflag_reserve_1 == '\0');
-  assert (io_page_p->prv.p_reserve_2 == 0);
   assert (io_page_p->prv.p_reserve_3 == 0);
 
   if (io_page_p->prv.pageid != NULL_PAGEID)
@@ -2816,6 +3095,43 @@ dwb_is_created (void)
   return DWB_IS_CREATED (position_with_flags);
 }
 
+/*
+ * dwb_is_bypassed () - Checks whether double write buffer is bypassed, because the storage is declared to write
+ *			whole pages atomically.
+ *
+ * return   : True, if bypassed.
+ *
+ *  Note: Torn pages are not expected in this case; pages are checked when read, since they can't be recovered.
+ */
+bool
+dwb_is_bypassed (void)
+{
+  return prm_get_integer_value (PRM_ID_DWB_ATOMIC_WRITE_SIZE) >= IO_PAGESIZE;
+}
+
+/*
+ * dwb_get_volume_writers_count () - Get the number of threads of the volume writers pool.
+ *
+ * return   : The number of pooled volume writers, 0 if the double write buffer is not used.
+ *
+ *  Note: The block writer is also a volume writer and is not pooled.
+ */
+int
+dwb_get_volume_writers_count (void)
+{
+#if defined (SERVER_MODE)
+  if (prm_get_integer_value (PRM_ID_DWB_SIZE) == 0 || prm_get_integer_value (PRM_ID_DWB_BLOCKS) == 0
+      || dwb_is_bypassed ())
+    {
+      return 0;
+    }
+
+  return MAX (prm_get_integer_value (PRM_ID_DWB_WRITERS) - 1, 0);
+#else /* !SERVER_MODE */
+  return 0;
+#endif /* !SERVER_MODE */
+}
+
 /*
  * dwb_create () - Create DWB.
  *
@@ -3998,6 +4314,23 @@ dwb_file_sync_helper_daemon_init ()
   dwb_file_sync_helper_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task);
 }
 
+/*
+ * dwb_volume_writers_init () - initialize the pool of threads writing DWB block pages of different volumes
+ */
+void
+dwb_volume_writers_init ()
+{
+  int pool_size = dwb_get_volume_writers_count ();
+
+  if (pool_size == 0)
+    {
+      return;
+    }
+
+  dwb_volume_writers_pool = cubthread::get_manager ()->create_worker_pool (pool_size, pool_size * DWB_MAX_BLOCKS,
+									  "dwb volume writers", NULL, 1, false);
+}
+
 /*
  * dwb_daemons_init () - initialize DWB daemon threads
  */
@@ -4006,6 +4339,7 @@ dwb_daemons_init ()
 {
   dwb_flush_block_daemon_init ();
   dwb_file_sync_helper_daemon_init ();
+  dwb_volume_writers_init ();
 }
 
 /*
@@ -4016,6 +4350,10 @@ dwb_daemons_destroy ()
 {
   cubthread::get_manager ()->destroy_daemon (dwb_flush_block_daemon);
   cubthread::get_manager ()->destroy_daemon (dwb_file_sync_helper_daemon);
+  if (dwb_volume_writers_pool != NULL)
+    {
+      cubthread::get_manager ()->destroy_worker_pool (dwb_volume_writers_pool);
+    }
 }
 #endif /* SERVER_MODE */
 // *INDENT-ON*
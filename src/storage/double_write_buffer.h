@@ -42,6 +42,8 @@ struct double_write_slot
 
 /* double write buffer interface */
 extern bool dwb_is_created (void);
+extern bool dwb_is_bypassed (void);
+extern int dwb_get_volume_writers_count (void);
 extern int dwb_create (THREAD_ENTRY * thread_p, const char *dwb_path_p, const char *db_name_p);
 extern int dwb_recreate (THREAD_ENTRY * thread_p);
 extern int dwb_load_and_recover_pages (THREAD_ENTRY * thread_p, const char *dwb_path_p, const char *db_name_p);
@@ -86,6 +86,7 @@
 #include "log_common_impl.h"
 #include "log_volids.hpp"
 #include "fault_injection.h"
+#include "crc32c.h"
 #if defined (SERVER_MODE)
 #include "vacuum.h"
 #endif /* SERVER_MODE */
@@ -449,6 +450,9 @@ static pthread_mutex_t fileio_Flushed_page_counter_mutex = PTHREAD_MUTEX_INITIAL
 #endif
 static int fileio_Flushed_page_count = 0;
 
+/* whether flushed data pages get a checksum; see fileio_enable_page_checksum */
+static bool fileio_Page_checksum_enabled = false;
+
 static TOKEN_BUCKET fc_Token_bucket_s;
 static TOKEN_BUCKET *fc_Token_bucket = NULL;
 static FLUSH_STATS fc_Stats;
@@ -2864,6 +2868,7 @@ fileio_copy_volume (THREAD_ENTRY * thread_p, int from_vol_desc, DKNPAGES npages,
 	  else
 	    {
 	      fileio_reset_page_lsa (malloc_io_page_p, IO_PAGESIZE);
+	      (void) fileio_set_page_checksum (thread_p, malloc_io_page_p);
 	      if (fileio_write_or_add_to_dwb (thread_p, to_vol_desc, malloc_io_page_p, page_id, IO_PAGESIZE) == NULL)
 		{
 		  goto error;
@@ -2921,6 +2926,7 @@ fileio_reset_volume (THREAD_ENTRY * thread_p, int vol_fd, const char *vlabel, DK
       if (fileio_read (thread_p, vol_fd, malloc_io_page_p, page_id, IO_PAGESIZE) != NULL)
 	{
 	  fileio_set_page_lsa (malloc_io_page_p, reset_lsa_p, IO_PAGESIZE);
+	  (void) fileio_set_page_checksum (thread_p, malloc_io_page_p);
 
 	  if (fileio_write_or_add_to_dwb (thread_p, vol_fd, malloc_io_page_p, page_id, IO_PAGESIZE) == NULL)
 	    {
@@ -4012,6 +4018,31 @@ fileio_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_i
   return io_page_p;
 }
 
+/*
+ * fileio_prefetch_pages () - Ask the operating system to read ahead a range of pages
+ *   return: void
+ *   vol_fd(in): Volume descriptor
+ *   page_id(in): First page identifier
+ *   num_pages(in): Number of consecutive pages
+ *   page_size(in): Page size
+ *
+ * Note: The call does not wait for the pages to be read; it is only a hint, so any failure is ignored. A later
+ *       fileio_read of the pages is expected to find them in the file system cache.
+ */
+void
+fileio_prefetch_pages (int vol_fd, PAGEID page_id, int num_pages, size_t page_size)
+{
+#if _POSIX_C_SOURCE >= 200112L
+  if (vol_fd == NULL_VOLDES || num_pages <= 0)
+    {
+      return;
+    }
+
+  (void) posix_fadvise (vol_fd, FILEIO_GET_FILE_SIZE (page_size, page_id), FILEIO_GET_FILE_SIZE (page_size, num_pages),
+			POSIX_FADV_WILLNEED);
+#endif /* _POSIX_C_SOURCE >= 200112L */
+}
+
 /*
  * fileio_write_or_add_to_dwb () - Write a page to disk if DWb disabled, otherwise add it to DWB
  *   return: io_page_p on success, NULL on failure
@@ -4048,8 +4079,16 @@ fileio_write_or_add_to_dwb (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * i
 	  /* Permanent volumes - uses DWB. */
 	  VPID_SET (&vpid, vol_info_p->volid, page_id);
 
-	  io_page_p->prv.volid = vol_info_p->volid;
-	  io_page_p->prv.pageid = page_id;
+	  if (io_page_p->prv.volid != vol_info_p->volid || io_page_p->prv.pageid != page_id)
+	    {
+	      io_page_p->prv.volid = vol_info_p->volid;
+	      io_page_p->prv.pageid = page_id;
+	      if (io_page_p->prv.checksum != 0)
+		{
+		  /* the page identifier is covered by the checksum */
+		  (void) fileio_set_page_checksum (thread_p, io_page_p);
+		}
+	    }
 
 	  error_code = dwb_add_page (thread_p, io_page_p, &vpid, &p_dwb_slot);
 	  if (error_code != NO_ERROR)
@@ -11524,7 +11563,7 @@ fileio_initialize_res (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, PGLENGTH
   io_page->prv.ptype = '\0';
   io_page->prv.pflag_reserve_1 = '\0';
   io_page->prv.p_reserve_1 = 0;
-  io_page->prv.p_reserve_2 = 0;
+  io_page->prv.checksum = 0;
   io_page->prv.p_reserve_3 = 0;
 }
 
@@ -11761,6 +11800,83 @@ fileio_page_bitmap_dump (FILE * out_fp, const FILEIO_RESTORE_PAGE_BITMAP * page_
   fprintf (out_fp, "\n");
 }
 
+/*
+ * fileio_compute_page_checksum - Compute the checksum of a page, as if its checksum field was 0.
+ *   return: the checksum, never 0
+ *   io_page (in): the page
+ */
+static INT32
+fileio_compute_page_checksum (const FILEIO_PAGE * io_page)
+{
+  const INT32 no_checksum = 0;
+  /* the reserved area is at the start of the page */
+  const size_t checksum_offset = offsetof (FILEIO_PAGE_RESERVED, checksum);
+  const size_t rest_offset = checksum_offset + sizeof (no_checksum);
+  unsigned int crc;
+
+  crc = crc32c (0, io_page, checksum_offset);
+  crc = crc32c (crc, &no_checksum, sizeof (no_checksum));
+  crc = crc32c (crc, ((const char *) io_page) + rest_offset, IO_PAGESIZE - rest_offset);
+
+  /* 0 is kept for pages without checksum */
+  return (crc != 0) ? (INT32) crc : 1;
+}
+
+/*
+ * fileio_set_page_checksum - Set the checksum of a page that is written to disk.
+ *   return: error code
+ *   thread_p (in): thread entry
+ *   io_page (in/out): the page copy to be written
+ *
+ * Note: The checksum is removed when checksums are disabled, since the page content may have changed since the
+ *       checksum was computed.
+ *       Besides the page buffer flush, this must be called by every path that changes a page read from disk before
+ *       writing it back, like the LSA reset of fileio_reset_volume and fileio_copy_volume.
+ */
+int
+fileio_set_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page)
+{
+  assert (io_page != NULL);
+
+  if (fileio_Page_checksum_enabled)
+    {
+      io_page->prv.checksum = fileio_compute_page_checksum (io_page);
+    }
+  else
+    {
+      io_page->prv.checksum = 0;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_enable_page_checksum - Enable or disable the checksum of flushed data pages.
+ *   return: void
+ *   enable (in): true to write checksums
+ *
+ * Note: The disk manager decides it at boot from data_page_checksum and the format of the database. Pages that already
+ *       have a checksum are verified either way.
+ */
+void
+fileio_enable_page_checksum (bool enable)
+{
+  fileio_Page_checksum_enabled = enable;
+}
+
+/*
+ * fileio_is_page_checksum_valid - Check the checksum of a page read from disk.
+ *   return: true, if the page has no checksum or the checksum matches the page content.
+ *   io_page (in): the page
+ */
+bool
+fileio_is_page_checksum_valid (const FILEIO_PAGE * io_page)
+{
+  assert (io_page != NULL);
+
+  return io_page->prv.checksum == 0 || io_page->prv.checksum == fileio_compute_page_checksum (io_page);
+}
+
 /*
  * fileio_page_check_corruption - Check whether the page is corrupted.
  *   return: error code
@@ -11773,7 +11889,7 @@ fileio_page_check_corruption (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, bo
 {
   assert (io_page != NULL && is_page_corrupted != NULL);
 
-  *is_page_corrupted = !fileio_is_page_sane (io_page, IO_PAGESIZE);
+  *is_page_corrupted = !fileio_is_page_sane (io_page, IO_PAGESIZE) || !fileio_is_page_checksum_valid (io_page);
 
   return NO_ERROR;
 }
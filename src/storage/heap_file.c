@@ -839,6 +839,7 @@ static void heap_log_delete_physical (THREAD_ENTRY * thread_p, PAGE_PTR page_p,
 static int heap_update_bigone (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context, bool is_mvcc_op);
 static int heap_update_relocation (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context, bool is_mvcc_op);
 static int heap_update_home (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context, bool is_mvcc_op);
+static bool heap_is_home_updatable (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context, int record_length);
 static int heap_update_physical (THREAD_ENTRY * thread_p, PAGE_PTR page_p, short slot_id, RECDES * recdes_p);
 static void heap_log_update_physical (THREAD_ENTRY * thread_p, PAGE_PTR page_p, VFID * vfid_p, OID * oid_p,
 				      RECDES * old_recdes_p, RECDES * new_recdes_p, LOG_RCVINDEX rcvindex);
@@ -21245,8 +21246,7 @@ heap_delete_home (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context, boo
 	{
 	  built_recdes.type = REC_BIGONE;
 	}
-      else if (!spage_is_updatable (thread_p, context->home_page_watcher_p->pgptr, context->oid.slotid,
-				    built_recdes.length))
+      else if (!heap_is_home_updatable (thread_p, context, built_recdes.length))
 	{
 	  built_recdes.type = REC_NEWHOME;
 	}
@@ -21933,6 +21933,38 @@ exit:
   return rc;
 }
 
+/*
+ * heap_is_home_updatable () - check if the home record can be replaced by a record of given length; if there is not
+ *			       enough space, dead versions are pruned from home page first
+ *   return: true if the new record fits in home page
+ *   thread_p(in): thread entry
+ *   context(in): operation context
+ *   record_length(in): length of the new record
+ */
+static bool
+heap_is_home_updatable (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context, int record_length)
+{
+  PAGE_PTR home_page_p = context->home_page_watcher_p->pgptr;
+
+  if (spage_is_updatable (thread_p, home_page_p, context->oid.slotid, record_length))
+    {
+      return true;
+    }
+
+  /* Relocating the object costs an extra page for every future access. Reclaim the space of versions no transaction
+   * can see anymore instead of waiting for vacuum. Slots of reusable heaps may be reused only after vacuum. */
+  if (heap_is_reusable_oid (context->file_type) || mvcc_is_mvcc_disabled_class (&context->class_oid))
+    {
+      return false;
+    }
+  if (vacuum_heap_page_prune (thread_p, home_page_p, context->oid.slotid) == 0)
+    {
+      return false;
+    }
+
+  return spage_is_updatable (thread_p, home_page_p, context->oid.slotid, record_length);
+}
+
 /*
  * heap_update_home () - update a REC_HOME record
  *   thread_p(in): thread entry
@@ -22013,8 +22045,7 @@ heap_update_home (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context, boo
 
       perfmon_inc_stat (thread_p, PSTAT_HEAP_HOME_TO_BIG_UPDATES);
     }
-  else if (!spage_is_updatable (thread_p, context->home_page_watcher_p->pgptr, context->oid.slotid,
-				context->recdes_p->length))
+  else if (!heap_is_home_updatable (thread_p, context, context->recdes_p->length))
     {
       /* insert new home */
 
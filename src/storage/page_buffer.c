@@ -29,6 +29,9 @@
 #include <stddef.h>
 #include <string.h>
 #include <assert.h>
+#include <mutex>
+#include <set>
+#include <utility>
 
 #include "page_buffer.h"
 
@@ -301,6 +304,11 @@ typedef enum
 /* default pages to flush in each interval during log checkpoint */
 #define PGBUF_CHKPT_BURST_PAGES 16
 
+/* number of lists of dirty pages ordered by oldest_unflush_lsa (BCBs are spread by their index) */
+#define PGBUF_DIRTY_LIST_COUNT 16
+#define PGBUF_FIND_DIRTY_LIST(bufptr) \
+  (&pgbuf_Pool.dirty_lists[pgbuf_bcb_get_pool_index (bufptr) % PGBUF_DIRTY_LIST_COUNT])
+
 #define INIT_HOLDER_STAT(perf_stat) \
   do \
     { \
@@ -350,6 +358,7 @@ typedef struct pgbuf_seq_flusher PGBUF_SEQ_FLUSHER;
 
 typedef struct pgbuf_invalid_list PGBUF_INVALID_LIST;
 typedef struct pgbuf_victim_candidate_list PGBUF_VICTIM_CANDIDATE_LIST;
+typedef struct pgbuf_dirty_list PGBUF_DIRTY_LIST;
 
 typedef struct pgbuf_buffer_pool PGBUF_BUFFER_POOL;
 
@@ -489,6 +498,8 @@ struct pgbuf_bcb
   int hit_age;			/* age of last hit (used to compute activities and quotas) */
 
   LOG_LSA oldest_unflush_lsa;	/* The oldest LSA record of the page that has not been written to disk */
+  LOG_LSA dirty_list_lsa;	/* LSA the page is registered with in its dirty list, NULL if it is not registered.
+				 * Protected by the mutex of the dirty list. */
   PGBUF_IOPAGE_BUFFER *iopage_buffer;	/* pointer to iopage buffer structure */
 };
 
@@ -672,6 +683,9 @@ struct pgbuf_page_quota
   int *private_lru_session_cnt;	/* Number of active session for each private LRU:  Contains only private lists ! */
   float private_pages_ratio;	/* Ratio of all private BCBs among total BCBs */
 
+  int temp_private_lru_id;	/* private LRU reserved for temporary pages; -1 if temporary pages are not separated */
+  int temp_quota;		/* fixed quota of temporary pages LRU */
+
   /* TODO: remove me --> */
   unsigned int add_shared_lru_idx;	/* circular index of shared LRU for relocating to shared */
   int avoid_shared_lru_idx;	/* index of shared LRU to avoid when relocating to shared;
@@ -724,6 +738,7 @@ struct pgbuf_buffer_pool
 
   PGBUF_VICTIM_CANDIDATE_LIST *victim_cand_list;
   PGBUF_SEQ_FLUSHER seq_chkpt_flusher;
+  PGBUF_DIRTY_LIST *dirty_lists;	/* dirty pages ordered by oldest_unflush_lsa, for incremental checkpoints */
 
   PGBUF_PAGE_MONITOR monitor;
   PGBUF_PAGE_QUOTA quota;
@@ -789,6 +804,17 @@ struct pgbuf_victim_candidate_list
   VPID vpid;			/* page id of the page managed by the BCB */
 };
 
+/* list of dirty pages ordered by oldest_unflush_lsa */
+/* A page is added when it gets its first unflushed LSA and removed only after it was written (or invalidated), so
+ * that the oldest entry of all lists is a safe redo point even while pages are being flushed. */
+struct pgbuf_dirty_list
+{
+  // *INDENT-OFF*
+  std::mutex mutex;
+  std::set<std::pair<LOG_LSA, int>> pages;	/* (dirty_list_lsa, bcb index) */
+  // *INDENT-ON*
+};
+
 static PGBUF_BUFFER_POOL pgbuf_Pool;	/* The buffer Pool */
 static PGBUF_BATCH_FLUSH_HELPER pgbuf_Flush_helper;
 
@@ -917,6 +943,11 @@ PGBUF_THREAD_HAS_PRIVATE_LRU (THREAD_ENTRY * thread_p)
 #define PGBUF_IS_SHARED_LRU_INDEX(lru_idx) ((lru_idx) < PGBUF_SHARED_LRU_COUNT)
 #define PGBUF_IS_PRIVATE_LRU_INDEX(lru_idx) ((lru_idx) >= PGBUF_SHARED_LRU_COUNT)
 
+/* temporary pages are kept in a private LRU that is not assigned to any thread and has its own fixed quota */
+#define PGBUF_TEMP_LRU_IS_ENABLED (pgbuf_Pool.quota.temp_private_lru_id >= 0)
+#define PGBUF_TEMP_LRU_INDEX (PGBUF_LRU_INDEX_FROM_PRIVATE (pgbuf_Pool.quota.temp_private_lru_id))
+#define PGBUF_IS_TEMP_LRU_INDEX(lru_idx) (PGBUF_TEMP_LRU_IS_ENABLED && (lru_idx) == PGBUF_TEMP_LRU_INDEX)
+
 #define PGBUF_LRU_LIST_IS_OVER_QUOTA(list) (PGBUF_LRU_LIST_COUNT (list) > (list)->quota)
 #define PGBUF_LRU_LIST_IS_ONE_TWO_OVER_QUOTA(list) ((PGBUF_LRU_ZONE_ONE_TWO_COUNT (list) > (list)->quota))
 #define PGBUF_LRU_LIST_OVER_QUOTA_COUNT(list) (PGBUF_LRU_LIST_COUNT (list) - (list)->quota)
@@ -1106,6 +1137,9 @@ static PGBUF_HOLDER *pgbuf_get_holder (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
 static void pgbuf_remove_watcher (PGBUF_HOLDER * holder, PGBUF_WATCHER * watcher_object);
 static int pgbuf_flush_chkpt_seq_list (THREAD_ENTRY * thread_p, PGBUF_SEQ_FLUSHER * seq_flusher,
 				       const LOG_LSA * prev_chkpt_redo_lsa, LOG_LSA * chkpt_smallest_lsa);
+static void pgbuf_dirty_list_add (PGBUF_BCB * bufptr, const LOG_LSA * lsa);
+static void pgbuf_dirty_list_update (PGBUF_BCB * bufptr);
+static void pgbuf_dirty_list_get_oldest (LOG_LSA * oldest_lsa);
 static int pgbuf_flush_seq_list (THREAD_ENTRY * thread_p, PGBUF_SEQ_FLUSHER * seq_flusher, struct timeval *limit_time,
 				 const LOG_LSA * prev_chkpt_redo_lsa, LOG_LSA * chkpt_smallest_lsa, int *time_rem);
 static int pgbuf_initialize_seq_flusher (PGBUF_SEQ_FLUSHER * seq_flusher, PGBUF_VICTIM_CANDIDATE_LIST * f_list,
@@ -1191,6 +1225,7 @@ STATIC_INLINE int pgbuf_find_current_wait_msecs (THREAD_ENTRY * thread_p) __attr
 
 static bool pgbuf_is_temp_lsa (const log_lsa & lsa);
 static void pgbuf_init_temp_page_lsa (FILEIO_PAGE * io_page, PGLENGTH page_size);
+static int pgbuf_check_read_page (const VPID * vpid, FILEIO_PAGE * io_page);
 
 static void pgbuf_scan_bcb_table (THREAD_ENTRY * thread_p);
 
@@ -1474,6 +1509,16 @@ pgbuf_initialize (void)
       goto error;
     }
 
+  /* the dirty lists cost a mutex on every change of a clean page; they are kept only for incremental checkpoints.
+   * pgbuf_dirty_list_add and pgbuf_dirty_list_update do nothing without them. */
+  pgbuf_Pool.dirty_lists = NULL;
+  if (prm_get_bool_value (PRM_ID_LOG_CHECKPOINT_INCREMENTAL))
+    {
+      /* *INDENT-OFF* */
+      pgbuf_Pool.dirty_lists = new PGBUF_DIRTY_LIST[PGBUF_DIRTY_LIST_COUNT];
+      /* *INDENT-ON* */
+    }
+
 #if defined(SERVER_MODE)
   pthread_mutex_init (&pgbuf_Pool.show_status_mutex, NULL);
 #endif
@@ -1669,6 +1714,11 @@ pgbuf_finalize (void)
       delete pgbuf_Pool.shared_lrus_with_victims;
       pgbuf_Pool.shared_lrus_with_victims = NULL;
     }
+  if (pgbuf_Pool.dirty_lists != NULL)
+    {
+      delete[] pgbuf_Pool.dirty_lists;
+      pgbuf_Pool.dirty_lists = NULL;
+    }
 
 #if defined(SERVER_MODE)
   pthread_mutex_destroy (&pgbuf_Pool.show_status_mutex);
@@ -2090,6 +2140,10 @@ try_again:
       perf.perf_page_type = pgbuf_get_page_type_for_stat (thread_p, pgptr);
 
       perfmon_inc_stat (thread_p, PSTAT_PB_NUM_FETCHES);
+      if (pgbuf_is_temporary_volume (vpid->volid))
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_PB_TEMP_NUM_FETCHES);
+	}
       if (request_mode == PGBUF_LATCH_READ)
 	{
 	  perf.perf_latch_mode = PERF_HOLDER_LATCH_READ;
@@ -2474,6 +2528,7 @@ pgbuf_unfix (THREAD_ENTRY * thread_p, PAGE_PTR pgptr)
       pgbuf_set_lsa (thread_p, pgptr, log_get_restart_lsa ());
       pgbuf_set_lsa (thread_p, pgptr, &restart_lsa);
       LSA_COPY (&bufptr->oldest_unflush_lsa, &bufptr->iopage_buffer->iopage.prv.lsa);
+      pgbuf_dirty_list_add (bufptr, &bufptr->oldest_unflush_lsa);
     }
 
   /* Check for over runs */
@@ -3642,6 +3697,245 @@ pgbuf_flush_checkpoint (THREAD_ENTRY * thread_p, const LOG_LSA * flush_upto_lsa,
 #undef  detailed_er_log
 }
 
+/*
+ * pgbuf_flush_checkpoint_incremental () - Flush only dirty pages whose oldest unflushed LSA is older than target_lsa
+ *   return: error code or NO_ERROR
+ *   flush_upto_lsa(in): LSA of new checkpoint
+ *   target_lsa(in): pages older than this LSA are flushed
+ *   prev_chkpt_redo_lsa(in): Redo_LSA of previous checkpoint
+ *   smallest_lsa(out): oldest unflushed LSA of all dirty pages, NULL if not older than flush_upto_lsa
+ *   flushed_page_cnt(out): The number of flushed pages
+ *
+ * Note: Unlike pgbuf_flush_checkpoint, pages changed after target_lsa are left in the buffer and the redo point is
+ *       the oldest LSA of the dirty lists. Called with the previous checkpoint LSA as target, each checkpoint only
+ *       writes the pages that stayed dirty for a whole checkpoint interval, at the checkpoint flush rate.
+ *       The dirty lists exist only if checkpoint_incremental was on when the server started; otherwise this is a
+ *       full checkpoint.
+ */
+int
+pgbuf_flush_checkpoint_incremental (THREAD_ENTRY * thread_p, const LOG_LSA * flush_upto_lsa,
+				    const LOG_LSA * target_lsa, const LOG_LSA * prev_chkpt_redo_lsa,
+				    LOG_LSA * smallest_lsa, int *flushed_page_cnt)
+{
+#define detailed_er_log(...) if (detailed_logging) _er_log_debug (ARG_FILE_LINE, __VA_ARGS__)
+  PGBUF_SEQ_FLUSHER *seq_flusher;
+  PGBUF_VICTIM_CANDIDATE_LIST *f_list;
+  PGBUF_DIRTY_LIST *dirty_list;
+  PGBUF_BCB *bufptr;
+  int collected_bcbs;
+  int flushed_page_cnt_local = 0;
+  int list_idx;
+  int error = NO_ERROR;
+  bool detailed_logging = prm_get_bool_value (PRM_ID_LOG_CHKPT_DETAILED);
+  LOG_LSA unused_lsa;
+
+  if (pgbuf_Pool.dirty_lists == NULL)
+    {
+      /* checkpoint_incremental was turned on after the server started */
+      return pgbuf_flush_checkpoint (thread_p, flush_upto_lsa, prev_chkpt_redo_lsa, smallest_lsa, flushed_page_cnt);
+    }
+
+  detailed_er_log ("pgbuf_flush_checkpoint_incremental start : flush_upto_LSA:%d, target_LSA:%d\n",
+		   flush_upto_lsa->pageid, target_lsa->pageid);
+
+  if (flushed_page_cnt != NULL)
+    {
+      *flushed_page_cnt = -1;
+    }
+
+  logpb_flush_log_for_wal (thread_p, flush_upto_lsa);
+  LSA_SET_NULL (smallest_lsa);
+
+  seq_flusher = &(pgbuf_Pool.seq_chkpt_flusher);
+  f_list = seq_flusher->flush_list;
+  LSA_COPY (&seq_flusher->flush_upto_lsa, target_lsa);
+
+#if defined (SERVER_MODE)
+  pgbuf_Pool.is_checkpoint = true;
+#endif
+
+  /* lists are ordered, so each one is collected from its beginning up to target_lsa. if the flush list gets full, it
+   * is flushed and the lists are collected again; flushed pages are no longer in them. */
+  do
+    {
+      collected_bcbs = 0;
+      for (list_idx = 0; list_idx < PGBUF_DIRTY_LIST_COUNT && collected_bcbs < seq_flusher->flush_max_size; list_idx++)
+	{
+	  dirty_list = &pgbuf_Pool.dirty_lists[list_idx];
+
+	  // *INDENT-OFF*
+	  std::lock_guard<std::mutex> lock (dirty_list->mutex);
+	  for (const std::pair<LOG_LSA, int> &entry : dirty_list->pages)
+	    {
+	      if (LSA_GT (&entry.first, target_lsa) || collected_bcbs >= seq_flusher->flush_max_size)
+		{
+		  break;
+		}
+	      bufptr = PGBUF_FIND_BCB_PTR (entry.second);
+	      f_list[collected_bcbs].bufptr = bufptr;
+	      VPID_COPY (&f_list[collected_bcbs].vpid, &bufptr->vpid);
+	      collected_bcbs++;
+	    }
+	  // *INDENT-ON*
+	}
+
+      if (collected_bcbs == 0)
+	{
+	  break;
+	}
+
+      seq_flusher->flush_cnt = collected_bcbs;
+      seq_flusher->flush_idx = 0;
+
+      qsort (f_list, seq_flusher->flush_cnt, sizeof (f_list[0]), pgbuf_compare_victim_list);
+
+      /* pages that cannot be flushed stay in the dirty lists; the redo point is computed from the lists below */
+      LSA_SET_NULL (&unused_lsa);
+      error = pgbuf_flush_chkpt_seq_list (thread_p, seq_flusher, prev_chkpt_redo_lsa, &unused_lsa);
+      flushed_page_cnt_local += seq_flusher->flushed_pages;
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+#if defined(SERVER_MODE)
+      if (thread_p != NULL && thread_p->shutdown == true)
+	{
+	  error = ER_FAILED;
+	  break;
+	}
+#endif
+    }
+  while (collected_bcbs >= seq_flusher->flush_max_size && seq_flusher->flushed_pages > 0);
+
+#if defined (SERVER_MODE)
+  pgbuf_Pool.is_checkpoint = false;
+#endif
+
+  if (error == NO_ERROR)
+    {
+      pgbuf_dirty_list_get_oldest (smallest_lsa);
+      if (!LSA_ISNULL (smallest_lsa) && LSA_GT (smallest_lsa, flush_upto_lsa))
+	{
+	  /* all pages changed before the checkpoint are written */
+	  LSA_SET_NULL (smallest_lsa);
+	}
+    }
+
+  detailed_er_log ("pgbuf_flush_checkpoint_incremental END flushed:%d, redo_LSA:%lld|%d\n", flushed_page_cnt_local,
+		   LSA_AS_ARGS (smallest_lsa));
+
+  if (flushed_page_cnt != NULL)
+    {
+      *flushed_page_cnt = flushed_page_cnt_local;
+    }
+
+  return error;
+
+#undef  detailed_er_log
+}
+
+/*
+ * pgbuf_dirty_list_add () - register the oldest unflushed LSA of page in its dirty list
+ *   return: void
+ *   bufptr(in): BCB
+ *   lsa(in): oldest unflushed LSA of page
+ *
+ * Note: If the page is still registered, because it is being flushed, it keeps the older LSA.
+ */
+static void
+pgbuf_dirty_list_add (PGBUF_BCB * bufptr, const LOG_LSA * lsa)
+{
+  PGBUF_DIRTY_LIST *dirty_list;
+
+  if (pgbuf_Pool.dirty_lists == NULL || LSA_ISNULL (lsa) || pgbuf_is_temporary_volume (bufptr->vpid.volid))
+    {
+      return;
+    }
+
+  dirty_list = PGBUF_FIND_DIRTY_LIST (bufptr);
+
+  // *INDENT-OFF*
+  std::lock_guard<std::mutex> lock (dirty_list->mutex);
+  if (!LSA_ISNULL (&bufptr->dirty_list_lsa))
+    {
+      if (LSA_LE (&bufptr->dirty_list_lsa, lsa))
+	{
+	  return;
+	}
+      dirty_list->pages.erase (std::make_pair (bufptr->dirty_list_lsa, pgbuf_bcb_get_pool_index (bufptr)));
+    }
+  bufptr->dirty_list_lsa = *lsa;
+  dirty_list->pages.emplace (bufptr->dirty_list_lsa, pgbuf_bcb_get_pool_index (bufptr));
+  // *INDENT-ON*
+}
+
+/*
+ * pgbuf_dirty_list_update () - register page with its current oldest unflushed LSA, after it was written or
+ *				invalidated
+ *   return: void
+ *   bufptr(in): BCB
+ *
+ * Note: The page leaves its dirty list if it was not changed since it was written. Otherwise, it is registered again
+ *       with the new oldest unflushed LSA. A concurrent pgbuf_dirty_list_add always follows the change of
+ *       oldest_unflush_lsa, so the page is never lost from the lists.
+ */
+static void
+pgbuf_dirty_list_update (PGBUF_BCB * bufptr)
+{
+  PGBUF_DIRTY_LIST *dirty_list;
+  LOG_LSA oldest_unflush_lsa;
+
+  if (pgbuf_Pool.dirty_lists == NULL || pgbuf_is_temporary_volume (bufptr->vpid.volid))
+    {
+      return;
+    }
+
+  dirty_list = PGBUF_FIND_DIRTY_LIST (bufptr);
+
+  // *INDENT-OFF*
+  std::lock_guard<std::mutex> lock (dirty_list->mutex);
+  if (LSA_ISNULL (&bufptr->dirty_list_lsa))
+    {
+      return;
+    }
+  dirty_list->pages.erase (std::make_pair (bufptr->dirty_list_lsa, pgbuf_bcb_get_pool_index (bufptr)));
+
+  oldest_unflush_lsa = bufptr->oldest_unflush_lsa;
+  bufptr->dirty_list_lsa = oldest_unflush_lsa;
+  if (!LSA_ISNULL (&oldest_unflush_lsa))
+    {
+      dirty_list->pages.emplace (oldest_unflush_lsa, pgbuf_bcb_get_pool_index (bufptr));
+    }
+  // *INDENT-ON*
+}
+
+/*
+ * pgbuf_dirty_list_get_oldest () - get the oldest unflushed LSA of all dirty pages
+ *   return: void
+ *   oldest_lsa(out): oldest LSA or NULL if there are no dirty pages
+ */
+static void
+pgbuf_dirty_list_get_oldest (LOG_LSA * oldest_lsa)
+{
+  PGBUF_DIRTY_LIST *dirty_list;
+  int list_idx;
+
+  LSA_SET_NULL (oldest_lsa);
+  for (list_idx = 0; list_idx < PGBUF_DIRTY_LIST_COUNT; list_idx++)
+    {
+      dirty_list = &pgbuf_Pool.dirty_lists[list_idx];
+
+      // *INDENT-OFF*
+      std::lock_guard<std::mutex> lock (dirty_list->mutex);
+      if (!dirty_list->pages.empty ()
+	  && (LSA_ISNULL (oldest_lsa) || LSA_LT (&dirty_list->pages.begin ()->first, oldest_lsa)))
+	{
+	  *oldest_lsa = dirty_list->pages.begin ()->first;
+	}
+      // *INDENT-ON*
+    }
+}
+
 /*
  * pgbuf_flush_chkpt_seq_list () - flush a sequence of pages during checkpoint
  *   return:error code or NO_ERROR
@@ -4396,6 +4690,7 @@ pgbuf_set_lsa (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, const LOG_LSA * lsa_ptr)
 
 	}
       LSA_COPY (&bufptr->oldest_unflush_lsa, lsa_ptr);
+      pgbuf_dirty_list_add (bufptr, lsa_ptr);
     }
 
 #if defined (NDEBUG)
@@ -4684,7 +4979,7 @@ pgbuf_set_bcb_page_vpid (PGBUF_BCB * bufptr, bool force_set_vpid)
 	  bufptr->iopage_buffer->iopage.prv.ptype = '\0';
 	  bufptr->iopage_buffer->iopage.prv.pflag_reserve_1 = '\0';
 	  bufptr->iopage_buffer->iopage.prv.p_reserve_1 = 0;
-	  bufptr->iopage_buffer->iopage.prv.p_reserve_2 = 0;
+	  bufptr->iopage_buffer->iopage.prv.checksum = 0;
 	  bufptr->iopage_buffer->iopage.prv.p_reserve_3 = 0;
 	}
     }
@@ -4851,6 +5146,7 @@ pgbuf_initialize_bcb_table (void)
       bufptr->count_fix_and_avoid_dealloc = 0;
       bufptr->hit_age = 0;
       LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
+      LSA_SET_NULL (&bufptr->dirty_list_lsa);
 
       bufptr->tick_lru3 = 0;
       bufptr->tick_lru_list = 0;
@@ -4867,7 +5163,7 @@ pgbuf_initialize_bcb_table (void)
       ioptr->iopage.prv.ptype = '\0';
       ioptr->iopage.prv.pflag_reserve_1 = '\0';
       ioptr->iopage.prv.p_reserve_1 = 0;
-      ioptr->iopage.prv.p_reserve_2 = 0;
+      ioptr->iopage.prv.checksum = 0;
       ioptr->iopage.prv.p_reserve_3 = 0;
 
       bufptr->iopage_buffer = ioptr;
@@ -6168,6 +6464,15 @@ pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int threa
 	}
     }
 
+  if (PGBUF_TEMP_LRU_IS_ENABLED && pgbuf_is_temporary_volume (bcb->vpid.volid))
+    {
+      /* temporary pages never leave their list. most of them are read only once, so they start in the middle and
+       * must be boosted to stay longer. */
+      pgbuf_lru_add_new_bcb_to_middle (thread_p, bcb, PGBUF_TEMP_LRU_INDEX);
+      perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_TO_PRIVATE_MID);
+      return;
+    }
+
   if (thread_private_lru_index != -1)
     {
       if (PGBUF_THREAD_SHOULD_IGNORE_UNFIX (thread_p))
@@ -6226,6 +6531,11 @@ pgbuf_should_move_private_to_shared (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, i
       /* not a private list */
       return false;
     }
+  if (PGBUF_IS_TEMP_LRU_INDEX (bcb_lru_idx))
+    {
+      /* temporary pages are never moved to shared lists */
+      return false;
+    }
 
   /* two conditions to move from private to shared:
    * 1. bcb is fixed by more than one transaction.
@@ -7547,6 +7857,10 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
     {
       /* Record number of reads in statistics */
       perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOREADS);
+      if (pgbuf_is_temporary_volume (vpid->volid))
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_PB_TEMP_NUM_IOREADS);
+	}
       ATOMIC_INC_64 (&(pgbuf_Pool.show_status.now.num_pages_read), 1);
 
 #if defined(ENABLE_SYSTEMTAP)
@@ -7569,7 +7883,8 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	  /* Nothing to do, copied from DWB */
 	}
       else if (fileio_read (thread_p, fileio_get_volume_descriptor (vpid->volid), &bufptr->iopage_buffer->iopage,
-			    vpid->pageid, IO_PAGESIZE) == NULL)
+			    vpid->pageid, IO_PAGESIZE) == NULL
+	       || pgbuf_check_read_page (vpid, &bufptr->iopage_buffer->iopage) != NO_ERROR)
 	{
 	  /* There was an error in reading the page. Clean the buffer... since it may have been corrupted */
 	  ASSERT_ERROR ();
@@ -7744,6 +8059,7 @@ pgbuf_invalidate_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
   pgbuf_bcb_clear_dirty (thread_p, bufptr);
 
   LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
+  pgbuf_dirty_list_update (bufptr);
 
   /* bufptr->mutex is still held by the caller. */
   switch (pgbuf_bcb_get_zone (bufptr))
@@ -9434,7 +9750,11 @@ pgbuf_move_bcb_to_bottom_lru (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
   if (zone == PGBUF_VOID_ZONE)
     {
       /* move to the bottom of a lru list so it can be found by flush thread */
-      if (PGBUF_THREAD_HAS_PRIVATE_LRU (thread_p))
+      if (PGBUF_TEMP_LRU_IS_ENABLED && pgbuf_is_temporary_volume (bcb->vpid.volid))
+	{
+	  lru_idx = PGBUF_TEMP_LRU_INDEX;
+	}
+      else if (PGBUF_THREAD_HAS_PRIVATE_LRU (thread_p))
 	{
 	  lru_idx = PGBUF_LRU_INDEX_FROM_PRIVATE (PGBUF_PRIVATE_LRU_FROM_THREAD (thread_p));
 	}
@@ -9820,6 +10140,13 @@ copy_unflushed_lsa:
   PGBUF_BCB_UNLOCK (bufptr);
   *is_bcb_locked = false;
 
+  if (!pgbuf_is_temporary_volume (bufptr->vpid.volid))
+    {
+      /* checksum the copy that is written; the page in buffer may already be changed again */
+      error = fileio_set_page_checksum (thread_p, (dwb_slot != NULL) ? dwb_slot->io_page : iopage);
+      assert (error == NO_ERROR);
+    }
+
   if (!LSA_ISNULL (&oldest_unflush_lsa))
     {
       /* confirm WAL protocol */
@@ -9901,6 +10228,9 @@ copy_unflushed_lsa:
       return ER_FAILED;
     }
 
+  /* the unflushed changes are written; the page leaves its dirty list unless it was changed again meanwhile */
+  pgbuf_dirty_list_update (bufptr);
+
   assert (bufptr->latch_mode != PGBUF_LATCH_FLUSH);
 
 #if defined (SERVER_MODE)
@@ -10245,7 +10575,6 @@ pgbuf_check_bcb_page_vpid (PGBUF_BCB * bufptr, bool maybe_deallocated)
 
       assert (bufptr->iopage_buffer->iopage.prv.pflag_reserve_1 == '\0');
       assert (bufptr->iopage_buffer->iopage.prv.p_reserve_1 == 0);
-      assert (bufptr->iopage_buffer->iopage.prv.p_reserve_2 == 0);
       assert (bufptr->iopage_buffer->iopage.prv.p_reserve_3 == 0);
 
       return (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
@@ -10281,7 +10610,7 @@ pgbuf_scramble (FILEIO_PAGE * iopage)
   iopage->prv.ptype = '\0';
   iopage->prv.pflag_reserve_1 = '\0';
   iopage->prv.p_reserve_1 = 0;
-  iopage->prv.p_reserve_2 = 0;
+  iopage->prv.checksum = 0;
   iopage->prv.p_reserve_3 = 0;
 }
 
@@ -12567,6 +12896,7 @@ pgbuf_initialize_page_quota_parameters (void)
   tsc_getticks (&quota->last_adjust_time);
   quota->adjust_age = 0;
   quota->is_adjusting = 0;
+  quota->temp_private_lru_id = -1;
 
 #if defined (SERVER_MODE)
   quota->num_private_LRU_list = prm_get_integer_value (PRM_ID_PB_NUM_PRIVATE_CHAINS);
@@ -12588,6 +12918,13 @@ pgbuf_initialize_page_quota_parameters (void)
 	  quota->num_private_LRU_list = PGBUF_PRIVATE_LRU_MIN_COUNT;
 	}
     }
+
+  if (quota->num_private_LRU_list > 0 && prm_get_float_value (PRM_ID_PB_TEMP_PAGE_RATIO) > 0.0f)
+    {
+      /* add one more private list for temporary pages */
+      quota->temp_private_lru_id = quota->num_private_LRU_list;
+      quota->num_private_LRU_list++;
+    }
 #else	/* !SERVER_MODE */		   /* SA_MODE */
   /* stand-alone quota is disabled */
   quota->num_private_LRU_list = 0;
@@ -12604,6 +12941,7 @@ static int
 pgbuf_initialize_page_quota (void)
 {
   PGBUF_PAGE_QUOTA *quota;
+  PGBUF_LRU_LIST *lru_list;
   int i;
   int error_status = NO_ERROR;
 
@@ -12652,6 +12990,20 @@ pgbuf_initialize_page_quota (void)
   quota->add_shared_lru_idx = 0;
   quota->avoid_shared_lru_idx = -1;
 
+  if (PGBUF_TEMP_LRU_IS_ENABLED)
+    {
+      quota->temp_quota = (int) (pgbuf_Pool.num_buffers * prm_get_float_value (PRM_ID_PB_TEMP_PAGE_RATIO));
+
+      lru_list = PGBUF_GET_LRU_LIST (PGBUF_TEMP_LRU_INDEX);
+      lru_list->quota = quota->temp_quota;
+      lru_list->threshold_lru1 = (int) (quota->temp_quota * PGBUF_LRU_ZONE_MIN_RATIO);
+      lru_list->threshold_lru2 = (int) (quota->temp_quota * PGBUF_LRU_ZONE_MIN_RATIO);
+    }
+  else
+    {
+      quota->temp_quota = 0;
+    }
+
 exit:
   return error_status;
 }
@@ -12949,7 +13301,11 @@ pgbuf_adjust_quotas (THREAD_ENTRY * thread_p)
       /* compute hits per second */
       lru_hits = (int) (onesec_usec * lru_hits / diff_usec);
 
-      if (PGBUF_IS_PRIVATE_LRU_INDEX (i))
+      if (PGBUF_IS_TEMP_LRU_INDEX (i))
+	{
+	  /* temporary pages list has a fixed quota, it is not sized by activity */
+	}
+      else if (PGBUF_IS_PRIVATE_LRU_INDEX (i))
 	{
 	  /* adjust private lru activity. for convenience reasons, we consider that previous lru_activity value was same
 	   * for 10 seconds minus the time since last adjustment. if previous adjustment is more than 10 seconds old
@@ -13012,6 +13368,10 @@ pgbuf_adjust_quotas (THREAD_ENTRY * thread_p)
       all_private_quota = 0;
       for (i = PGBUF_SHARED_LRU_COUNT; i < PGBUF_TOTAL_LRU_COUNT; i++)
 	{
+	  if (PGBUF_IS_TEMP_LRU_INDEX (i))
+	    {
+	      continue;
+	    }
 	  lru_list = PGBUF_GET_LRU_LIST (i);
 
 	  lru_list->quota = 0;
@@ -13039,11 +13399,16 @@ pgbuf_adjust_quotas (THREAD_ENTRY * thread_p)
     {
       /* compute all_private_quota in number of bcb's */
       all_private_quota =
-	(int) ((pgbuf_Pool.num_buffers - pgbuf_Pool.buf_invalid_list.invalid_cnt) * quota->private_pages_ratio);
+	(int) ((pgbuf_Pool.num_buffers - pgbuf_Pool.buf_invalid_list.invalid_cnt - quota->temp_quota)
+	       * quota->private_pages_ratio);
 
       /* split private bcb's quota's based on activity */
       for (i = PGBUF_SHARED_LRU_COUNT; i < PGBUF_TOTAL_LRU_COUNT; i++)
 	{
+	  if (PGBUF_IS_TEMP_LRU_INDEX (i))
+	    {
+	      continue;
+	    }
 	  if (monitor->lru_activity[i] > 0)
 	    {
 	      new_lru_ratio = (float) monitor->lru_activity[i] / (float) sum_private_lru_activity_total;
@@ -13082,8 +13447,18 @@ pgbuf_adjust_quotas (THREAD_ENTRY * thread_p)
 	}
     }
 
+  if (PGBUF_TEMP_LRU_IS_ENABLED)
+    {
+      lru_list = PGBUF_GET_LRU_LIST (PGBUF_TEMP_LRU_INDEX);
+      if (lru_list->count_vict_cand > 0 && PGBUF_LRU_LIST_IS_OVER_QUOTA (lru_list))
+	{
+	  /* make sure this is added to victim list */
+	  (void) pgbuf_lfcq_add_lru_with_victims (lru_list);
+	}
+    }
+
   /* set shared target size */
-  avg_shared_lru_size = (pgbuf_Pool.num_buffers - all_private_quota) / pgbuf_Pool.num_LRU_list;
+  avg_shared_lru_size = (pgbuf_Pool.num_buffers - all_private_quota - quota->temp_quota) / pgbuf_Pool.num_LRU_list;
   avg_shared_lru_size = MAX (avg_shared_lru_size, PGBUF_MIN_SHARED_LIST_ADJUST_SIZE);
   shared_threshold_lru1 = (int) (avg_shared_lru_size * pgbuf_Pool.ratio_lru1);
   shared_threshold_lru2 = (int) (avg_shared_lru_size * pgbuf_Pool.ratio_lru2);
@@ -13156,6 +13531,11 @@ retry:
   min_activitity = PGBUF_TRAN_MAX_ACTIVITY;
   for (i = PGBUF_SHARED_LRU_COUNT; i < PGBUF_TOTAL_LRU_COUNT; i++)
     {
+      if (PGBUF_IS_TEMP_LRU_INDEX (i))
+	{
+	  /* reserved for temporary pages */
+	  continue;
+	}
       if (quota->private_lru_session_cnt[PGBUF_PRIVATE_LIST_FROM_LRU_INDEX (i)] == 0)
 	{
 	  cnt_lru = PGBUF_LRU_LIST_COUNT (PGBUF_GET_LRU_LIST (i));
@@ -15847,6 +16227,41 @@ pgbuf_init_temp_page_lsa (FILEIO_PAGE * io_page, PGLENGTH page_size)
   prv2->lsa = PGBUF_TEMP_LSA;
 }
 
+/*
+ * pgbuf_check_read_page () - check the page read from disk is not corrupted or torn
+ *
+ * return      : error code
+ * vpid (in)   : page identifier
+ * io_page (in) : page read from disk
+ *
+ * note: torn pages are restored from the double write buffer during recovery. when the double write buffer is bypassed
+ *       because storage writes pages atomically, a torn page can't be restored and must not be used.
+ */
+static int
+pgbuf_check_read_page (const VPID * vpid, FILEIO_PAGE * io_page)
+{
+  if (pgbuf_is_temporary_volume (vpid->volid))
+    {
+      return NO_ERROR;
+    }
+
+  if (!fileio_is_page_checksum_valid (io_page))
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_PB_PAGE_CHECKSUM_MISMATCH, 2, vpid->pageid,
+	      fileio_get_volume_label (vpid->volid, PEEK));
+      return ER_PB_PAGE_CHECKSUM_MISMATCH;
+    }
+
+  if (dwb_is_bypassed () && !fileio_is_page_sane (io_page, IO_PAGESIZE))
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_PB_TORN_PAGE, 2, vpid->pageid,
+	      fileio_get_volume_label (vpid->volid, PEEK));
+      return ER_PB_TORN_PAGE;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * pgbuf_scan_bcb_table () - scan bcb table to count snapshot data with no bcb mutex
  */
@@ -5151,15 +5151,9 @@ locator_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
       locator_increase_catalog_count (thread_p, &real_class_oid);
 #endif
 
-      /* remove query result cache entries which are relevant with this class */
+      /* record the class so that the query results relevant with it are invalidated when the transaction ends */
       if (!QFILE_IS_LIST_CACHE_DISABLED)
 	{
-	  if (qexec_clear_list_cache_by_class (thread_p, &real_class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "locator_insert_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    real_class_oid.pageid, real_class_oid.slotid, real_class_oid.volid);
-	    }
 	  qmgr_add_modified_class (thread_p, &real_class_oid);
 	}
 #if 0				/* TODO - dead code; do not delete me */
@@ -5935,15 +5929,9 @@ locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
 	}
 #endif
 
-      /* remove query result cache entries which are relevant with this class */
+      /* record the class so that the query results relevant with it are invalidated when the transaction ends */
       if (!QFILE_IS_LIST_CACHE_DISABLED)
 	{
-	  if (qexec_clear_list_cache_by_class (thread_p, class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "locator_update_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    class_oid->pageid, class_oid->slotid, class_oid->volid);
-	    }
 	  qmgr_add_modified_class (thread_p, class_oid);
 	}
     }
@@ -6235,15 +6223,9 @@ locator_delete_force_internal (THREAD_ENTRY * thread_p, HFID * hfid, OID * oid,
 	    }
 	}
 
-      /* remove query result cache entries which are relevant with this class */
+      /* record the class so that the query results relevant with it are invalidated when the transaction ends */
       if (!QFILE_IS_LIST_CACHE_DISABLED)
 	{
-	  if (qexec_clear_list_cache_by_class (thread_p, &class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "locator_delete_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    class_oid.pageid, class_oid.slotid, class_oid.volid);
-	    }
 	  qmgr_add_modified_class (thread_p, &class_oid);
 	}
     }
@@ -13701,11 +13683,109 @@ xlocator_demote_class_lock (THREAD_ENTRY * thread_p, const OID * class_oid, LOCK
 }
 
 // *INDENT-OFF*
+/*
+ * locator_multi_insert_new_page () - insert a set of records into a newly allocated heap page
+ *
+ * return : error code
+ * thread_p (in)          : thread entry
+ * hfid (in)              : heap file identifier
+ * class_oid (in)         : class identifier
+ * recdes_array (in)      : records that all fit into one heap page
+ * has_index (in)         : true if indexes must be updated
+ * op_type (in)           : operation type
+ * scan_cache (in)        : scan cache
+ * force_count (out)      : number of forced objects
+ * pruning_type (in)      : pruning type
+ * pcontext (in)          : pruning context
+ * func_preds (in)        : function index predicates
+ * force_in_place (in)    : update in place style
+ * has_BU_lock (in)       : true if the transaction holds BU_LOCK on class
+ * dont_check_fk (in)     : true to skip foreign key checks
+ * heap_pages_array (out) : the new page is appended here, to be linked to the heap on postpone
+ *
+ * Note: records are not logged one by one; the whole page is logged once after it is filled.
+ */
+static int
+locator_multi_insert_new_page (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid,
+			       std::vector<RECDES> &recdes_array, int has_index, int op_type,
+			       HEAP_SCANCACHE * scan_cache, int *force_count, int pruning_type,
+			       PRUNING_CONTEXT * pcontext, FUNC_PRED_UNPACK_INFO * func_preds,
+			       UPDATE_INPLACE_STYLE force_in_place, bool has_BU_lock, bool dont_check_fk,
+			       std::vector<VPID> &heap_pages_array)
+{
+  int error_code = NO_ERROR;
+  OID dummy_oid;
+  VPID new_page_vpid;
+  PGBUF_WATCHER home_hint_p;
+
+  VPID_SET_NULL (&new_page_vpid);
+  scan_cache->cache_last_fix_page = true;
+
+  // First alloc a new empty heap page.
+  error_code = heap_alloc_new_page (thread_p, hfid, *class_oid, &home_hint_p, &new_page_vpid);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  for (size_t j = 0; j < recdes_array.size (); j++)
+    {
+      error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[j], has_index,
+					 op_type, scan_cache, force_count, pruning_type, pcontext, func_preds,
+					 force_in_place, &home_hint_p, has_BU_lock, dont_check_fk, true);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+
+	  if (home_hint_p.pgptr)
+	    {
+	      pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
+	    }
+
+	  if (scan_cache->page_watcher.pgptr)
+	    {
+	      pgbuf_ordered_unfix_and_init (thread_p, scan_cache->page_watcher.pgptr, &scan_cache->page_watcher);
+	    }
+
+	  assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
+
+	  return error_code;
+	}
+
+      pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &home_hint_p);
+    }
+
+  // Now log the whole page.
+  pgbuf_log_redo_new_page (thread_p, home_hint_p.pgptr, DB_PAGESIZE, PAGE_HEAP);
+
+  // Add the new VPID to the VPID array.
+  assert (!VPID_ISNULL (&new_page_vpid));
+  heap_pages_array.push_back (new_page_vpid);
+
+  // Unfix the page.
+  pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
+
+  assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
+
+  return NO_ERROR;
+}
+
+/*
+ * locator_multi_insert_force () - insert a set of records; records that fill a whole page are inserted into a new
+ *                                 heap page which is logged once and appended to the heap on postpone.
+ *
+ * return : error code
+ *
+ * Note: when is_direct_path is true (direct path load into an empty class), the remaining records that do not fill
+ *       a page are placed into a new page too, instead of searching the heap for free space and logging each record.
+ */
 int
 locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid,
 			    const std::vector<record_descriptor> &recdes, int has_index, int op_type,
 			    HEAP_SCANCACHE * scan_cache, int *force_count, int pruning_type, PRUNING_CONTEXT * pcontext,
-			    FUNC_PRED_UNPACK_INFO * func_preds, UPDATE_INPLACE_STYLE force_in_place, bool dont_check_fk)
+			    FUNC_PRED_UNPACK_INFO * func_preds, UPDATE_INPLACE_STYLE force_in_place, bool dont_check_fk,
+			    bool is_direct_path)
 {
   int error_code = NO_ERROR;
   size_t accumulated_records_size = 0;
@@ -13724,6 +13804,9 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
       return NO_ERROR;
     }
 
+  // Direct path requires exclusive ownership of the class.
+  assert (!is_direct_path || has_BU_lock);
+
   *force_count = 0;
 
   // Take into account the unfill factor of the heap file.
@@ -13753,64 +13836,18 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	  if ((DB_ALIGN (local_record.length, HEAP_MAX_ALIGN) + record_overhead + accumulated_records_size)
 	      >= heap_max_page_size)
 	    {
-	      VPID new_page_vpid;
-	      PGBUF_WATCHER home_hint_p;
-
-	      VPID_SET_NULL (&new_page_vpid);
-	      scan_cache->cache_last_fix_page = true;
-
-	      // First alloc a new empty heap page.
-	      error_code = heap_alloc_new_page (thread_p, hfid, *class_oid, &home_hint_p, &new_page_vpid);
+	      error_code = locator_multi_insert_new_page (thread_p, hfid, class_oid, recdes_array, has_index, op_type,
+							  scan_cache, force_count, pruning_type, pcontext, func_preds,
+							  force_in_place, has_BU_lock, dont_check_fk,
+							  heap_pages_array);
 	      if (error_code != NO_ERROR)
 		{
-		  ASSERT_ERROR ();
 		  return error_code;
 		}
 
-	      for (size_t j = 0; j < recdes_array.size (); j++)
-		{
-		  error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[j], has_index,
-						     op_type, scan_cache, force_count, pruning_type, pcontext,
-						     func_preds, force_in_place, &home_hint_p, has_BU_lock,
-						     dont_check_fk, true);
-		  if (error_code != NO_ERROR)
-		    {
-		      ASSERT_ERROR ();
-
-		      if (home_hint_p.pgptr)
-			{
-			  pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
-			}
-
-		      if (scan_cache->page_watcher.pgptr)
-			{
-			  pgbuf_ordered_unfix_and_init (thread_p, scan_cache->page_watcher.pgptr,
-							&scan_cache->page_watcher);
-			}
-
-		      assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
-
-		      return error_code;
-		    }
-
-		  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &home_hint_p);
-		}
-
-	      // Now log the whole page.
-	      pgbuf_log_redo_new_page (thread_p, home_hint_p.pgptr, DB_PAGESIZE, PAGE_HEAP);
-
-	      // Add the new VPID to the VPID array.
-	      assert (!VPID_ISNULL (&new_page_vpid));
-	      heap_pages_array.push_back (new_page_vpid);
-
 	      // Clear the recdes array.
 	      recdes_array.clear ();
 	      accumulated_records_size = 0;
-
-	      // Unfix the page.
-	      pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
-
-	      assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
 	    }
 
 	  // Add this record to the recdes array and increase the accumulated size.
@@ -13820,6 +13857,20 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	}
     }
 
+  if (is_direct_path && !recdes_array.empty ())
+    {
+      // The class was empty when the load started and nobody else can insert into it, so there is no free space
+      // worth searching for. Build a page out of the remaining records too.
+      error_code = locator_multi_insert_new_page (thread_p, hfid, class_oid, recdes_array, has_index, op_type,
+						  scan_cache, force_count, pruning_type, pcontext, func_preds,
+						  force_in_place, has_BU_lock, dont_check_fk, heap_pages_array);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+      recdes_array.clear ();
+    }
+
   // We must check if we have records which did not fill an entire page.
   for (size_t i = 0; i < recdes_array.size (); i++)
     {
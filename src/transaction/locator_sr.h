@@ -139,7 +139,8 @@ extern int locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID
 				       const std::vector<record_descriptor> &recdes, int has_index, int op_type,
 				       HEAP_SCANCACHE * scan_cache, int *force_count, int pruning_type,
 				       PRUNING_CONTEXT * pcontext, FUNC_PRED_UNPACK_INFO * func_preds,
-				       UPDATE_INPLACE_STYLE force_in_place, bool dont_check_fk);
+				       UPDATE_INPLACE_STYLE force_in_place, bool dont_check_fk,
+				       bool is_direct_path = false);
 extern bool has_errors_filtered_for_insert (std::vector<int> error_filter_array);
 // *INDENT-ON*
 
@@ -4771,6 +4771,9 @@ log_commit_local (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool retain_lock, bo
    * be rolled back. */
   logtb_complete_mvcc (thread_p, tdes, true);
 
+  /* the changes are visible to new snapshots now; invalidate the query results cached before */
+  qmgr_clear_modified_classes (thread_p, tdes->tran_index);
+
   tdes->state = TRAN_UNACTIVE_WILL_COMMIT;
   /* undo_nxlsa is no longer required here and must be reset, in case checkpoint takes a snapshot of this transaction
    * during TRAN_UNACTIVE_WILL_COMMIT phase.
@@ -6632,11 +6632,26 @@ logpb_checkpoint (THREAD_ENTRY * thread_p)
       goto error_cannot_chkpt;
     }
 
-  detailed_er_log ("logpb_checkpoint: call pgbuf_flush_checkpoint()\n");
-  if (pgbuf_flush_checkpoint (thread_p, &newchkpt_lsa, &chkpt_redo_lsa, &tmp_chkpt.redo_lsa, &flushed_page_cnt) !=
-      NO_ERROR)
+  if (prm_get_bool_value (PRM_ID_LOG_CHECKPOINT_INCREMENTAL) && !LSA_ISNULL (&chkpt_lsa)
+      && LSA_LT (&chkpt_lsa, &newchkpt_lsa))
     {
-      goto error_cannot_chkpt;
+      /* Flush only the pages not written since the previous checkpoint; the redo point becomes the oldest LSA of the
+       * pages left dirty. */
+      detailed_er_log ("logpb_checkpoint: call pgbuf_flush_checkpoint_incremental()\n");
+      if (pgbuf_flush_checkpoint_incremental (thread_p, &newchkpt_lsa, &chkpt_lsa, &chkpt_redo_lsa,
+					      &tmp_chkpt.redo_lsa, &flushed_page_cnt) != NO_ERROR)
+	{
+	  goto error_cannot_chkpt;
+	}
+    }
+  else
+    {
+      detailed_er_log ("logpb_checkpoint: call pgbuf_flush_checkpoint()\n");
+      if (pgbuf_flush_checkpoint (thread_p, &newchkpt_lsa, &chkpt_redo_lsa, &tmp_chkpt.redo_lsa, &flushed_page_cnt) !=
+	  NO_ERROR)
+	{
+	  goto error_cannot_chkpt;
+	}
     }
 
   detailed_er_log ("logpb_checkpoint: call fileio_synchronize_all()\n");
@@ -31,6 +31,14 @@
 #include <string.h>
 #include <time.h>
 #include <assert.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "log_2pc.h"
 #include "log_append.hpp"
@@ -50,10 +58,15 @@
 #include "boot_sr.h"
 #include "locator_sr.h"
 #include "page_buffer.h"
+#include "file_io.h"
 #include "porting_inline.hpp"
 #include "log_compress.h"
 #include "thread_entry.hpp"
 #include "thread_manager.hpp"
+#include "thread_worker_pool.hpp"
+
+// forward definition
+class log_rv_dirty_page_table;
 
 static void log_rv_undo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				LOG_RCVINDEX rcvindex, const VPID * rcv_vpid, LOG_RCV * rcv,
@@ -102,11 +115,12 @@ static bool log_is_page_of_record_broken (THREAD_ENTRY * thread_p, const LOG_LSA
 					  const LOG_RECORD_HEADER * log_rec_header);
 static void log_recovery_analysis (THREAD_ENTRY * thread_p, LOG_LSA * start_lsa, LOG_LSA * start_redolsa,
 				   LOG_LSA * end_redo_lsa, bool ismedia_crash, time_t * stopat,
-				   bool * did_incom_recovery, INT64 * num_redo_log_records);
+				   bool * did_incom_recovery, INT64 * num_redo_log_records,
+				   log_rv_dirty_page_table * dirty_pages);
 static bool log_recovery_needs_skip_logical_redo (THREAD_ENTRY * thread_p, TRANID tran_id, LOG_RECTYPE log_rtype,
 						  LOG_RCVINDEX rcv_index, const LOG_LSA * lsa);
 static void log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const LOG_LSA * end_redo_lsa,
-			       time_t * stopat);
+			       time_t * stopat, log_rv_dirty_page_table * dirty_pages);
 static void log_recovery_abort_interrupted_sysop (THREAD_ENTRY * thread_p, LOG_TDES * tdes,
 						  const LOG_LSA * postpone_start_lsa);
 static void log_recovery_finish_sysop_postpone (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
@@ -133,6 +147,151 @@ STATIC_INLINE PAGE_PTR log_rv_redo_fix_page (THREAD_ENTRY * thread_p, const VPID
 static void log_rv_simulate_runtime_worker (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
 static void log_rv_end_simulation (THREAD_ENTRY * thread_p);
 
+/*
+ * Parallel redo.
+ *
+ * Redo records of data pages are applied by a pool of worker threads, while the recovery thread reads, uncompresses
+ * and dispatches the log records ahead of them. Records are partitioned by VPID, so all records of one page are
+ * applied by the same worker, in LSA order. Records that are not confined to their page (logical records, new page
+ * initializations that check disk sector reservations, disk and vacuum records) are applied by the recovery thread,
+ * after the workers applied everything dispatched before them.
+ */
+#define LOG_RV_REDO_MAX_QUEUED_JOBS 1024
+
+// *INDENT-OFF*
+struct log_rv_dirty_page;
+
+struct log_rv_redo_job
+{
+  VPID vpid;
+  log_rv_dirty_page *dirty_page;	/* entry of page in dirty page table, or NULL */
+  LOG_LSA rcv_lsa;
+  LOG_RCVINDEX rcvindex;
+  bool is_compensate;		/* apply undo function of compensate record */
+  PGLENGTH offset;
+  MVCCID mvcc_id;
+  std::vector<char> data;	/* uncompressed redo data */
+};
+
+class log_rv_redo_partition
+{
+  public:
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<log_rv_redo_job *> m_jobs;
+    bool m_is_applying = false;
+    bool m_stop = false;
+};
+
+class log_rv_redo_context : public cubthread::entry_manager
+{
+  protected:
+    void on_create (context_type &context) override;
+    void on_retire (context_type &context) override;
+    void on_recycle (context_type &context) override;
+};
+
+class log_rv_redo_task : public cubthread::entry_task
+{
+  public:
+    log_rv_redo_task () = delete;
+    explicit log_rv_redo_task (log_rv_redo_partition &partition);
+
+    void execute (cubthread::entry &thread_ref) override;
+
+  private:
+    void apply (cubthread::entry &thread_ref, const log_rv_redo_job &job);
+
+    log_rv_redo_partition &m_partition;
+};
+
+class log_rv_parallel_redo
+{
+  public:
+    log_rv_parallel_redo () = delete;
+    explicit log_rv_parallel_redo (size_t worker_count);
+    ~log_rv_parallel_redo ();
+
+    bool start ();
+    void dispatch (log_rv_redo_job *job);
+    void wait_for_idle ();
+
+  private:
+    log_rv_redo_context m_context;
+    cubthread::entry_workpool *m_workpool;
+    std::vector<log_rv_redo_partition> m_partitions;
+};
+// *INDENT-ON*
+
+/*
+ * Dirty page table.
+ *
+ * The analysis phase registers every page changed by the redo records it reads, with the addresses of the first and
+ * the last of these records. The redo phase uses the table to read ahead the pages it is about to need, and to skip,
+ * without fixing the page, the records of a page whose LSA was already seen to cover its last analysed record.
+ * The table holds at most as many pages as the page buffer. If the analysis finds more, the table is dropped and
+ * the redo runs without it, like it does when no table is given.
+ */
+#define LOG_RV_PREFETCH_WINDOW 256	/* number of pages read ahead of redo */
+
+// *INDENT-OFF*
+struct log_rv_dirty_page
+{
+  VPID vpid;
+  LOG_LSA first_lsa;		/* first redo record of page found by analysis */
+  LOG_LSA last_lsa;		/* last redo record of page found by analysis */
+  std::atomic<bool> is_redo_covered;	/* page LSA was seen greater or equal to last_lsa */
+
+  log_rv_dirty_page (const VPID &vpid_arg, const LOG_LSA &lsa_arg);
+};
+
+struct log_rv_vpid_hash
+{
+  size_t operator() (const VPID &vpid) const;
+};
+
+struct log_rv_vpid_equal
+{
+  bool operator() (const VPID &left, const VPID &right) const;
+};
+
+class log_rv_dirty_page_table
+{
+  public:
+    log_rv_dirty_page_table ();
+
+    void add (const VPID &vpid, const LOG_LSA &rcv_lsa);
+    void set_incomplete ();
+    bool is_dropped () const;
+    log_rv_dirty_page *find (const VPID &vpid);
+    void prefetch (const LOG_LSA &redo_lsa);
+    LOG_PAGE *get_log_page_buffer ();
+
+  private:
+    std::deque<log_rv_dirty_page> m_pages;	/* ordered by first_lsa */
+    std::unordered_map<VPID, log_rv_dirty_page *, log_rv_vpid_hash, log_rv_vpid_equal> m_page_map;
+    size_t m_redo_index;		/* first page not yet reached by redo */
+    size_t m_prefetch_index;		/* first page not yet read ahead */
+    size_t m_max_pages;			/* the table is dropped when analysis finds more pages */
+    bool m_is_complete;			/* false if analysis could not register all records */
+    bool m_is_dropped;			/* true if the table grew past m_max_pages and was released */
+    char m_log_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+};
+// *INDENT-ON*
+
+static int log_rv_get_redo_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+				 int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr, char **area);
+static bool log_rv_redo_is_parallel (log_rv_parallel_redo * parallel_redo, const VPID * rcv_vpid,
+				     LOG_RCVINDEX rcvindex);
+static void log_rv_redo_dispatch (THREAD_ENTRY * thread_p, log_rv_parallel_redo * parallel_redo, LOG_LSA * log_lsa,
+				  LOG_PAGE * log_page_p, const VPID * rcv_vpid, log_rv_dirty_page * dirty_page,
+				  LOG_RCVINDEX rcvindex, bool is_compensate, LOG_RCV * rcv, const LOG_LSA * rcv_lsa,
+				  int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr);
+static void log_rv_analysis_dirty_page (THREAD_ENTRY * thread_p, LOG_RECTYPE log_type, const LOG_LSA * log_lsa,
+					LOG_PAGE * log_page_p, log_rv_dirty_page_table * dirty_pages);
+static log_rv_dirty_page *log_rv_find_dirty_page (log_rv_dirty_page_table * dirty_pages, const VPID * vpid);
+static void log_rv_check_redo_covered (log_rv_dirty_page * dirty_page, const LOG_LSA * page_lsa);
+
 /*
  * CRASH RECOVERY PROCESS
  */
@@ -410,40 +569,29 @@ end:
 }
 
 /*
- * log_rv_redo_record - EXECUTE A REDO RECORD
+ * log_rv_get_redo_data - GET REDO DATA OF A LOG RECORD
  *
- * return: nothing
- *
- *   log_lsa(in/out): Log address identifier containing the log record
- *   log_page_p(in/out): Pointer to page where data starts (Set as a side
- *               effect to the page where data ends)
- *   redofun(in): Function to invoke to redo the data
- *   rcv(in/out): Recovery structure for recovery function(Set as a side
- *               effect)
- *   rcv_lsa_ptr(in): Reset data page (rcv->pgptr) to this LSA
- *   ignore_redofunc(in):
- *   undo_length(in):
- *   undo_data(in):
- *   redo_unzip_ptr(in):
+ * return: error code
  *
- * NOTE: Execute a redo log record.
+ *   log_lsa(in/out): Log address identifier where the redo data starts (Set as a side effect to where data ends)
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side effect to the page where data ends)
+ *   rcv(in/out): Recovery structure. On input, rcv->length is the length of logged data; on output, rcv->data and
+ *                rcv->length describe the uncompressed redo data
+ *   undo_length(in): length of undo data, for diff records
+ *   undo_data(in): undo data, for diff records
+ *   redo_unzip_ptr(in): buffer to uncompress redo data
+ *   area(out): allocated area that the caller must free after using the data, or NULL
+ *
+ * NOTE: If data is contained in only one buffer, point to it directly. Otherwise, allocate a contiguous area and copy
+ *       the data.
  */
-static void
-log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
-		    int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv, LOG_LSA * rcv_lsa_ptr,
-		    int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr)
+static int
+log_rv_get_redo_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+		      int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr, char **area)
 {
-  char *area = NULL;
   bool is_zip = false;
-  int error_code;
 
-  /* Note the the data page rcv->pgptr has been fetched by the caller */
-
-  /*
-   * If data is contained in only one buffer, pass pointer directly.
-   * Otherwise, allocate a contiguous area, copy the data and pass this area.
-   * At the end deallocate the area.
-   */
+  *area = NULL;
 
   if (ZIP_CHECK (rcv->length))
     {
@@ -458,37 +606,72 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
     }
   else
     {
-      area = (char *) malloc (rcv->length);
-      if (area == NULL)
+      *area = (char *) malloc (rcv->length);
+      if (*area == NULL)
 	{
-	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
-	  return;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) rcv->length);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
 	}
       /* Copy the data */
-      logpb_copy_from_log (thread_p, area, rcv->length, log_lsa, log_page_p);
-      rcv->data = area;
+      logpb_copy_from_log (thread_p, *area, rcv->length, log_lsa, log_page_p);
+      rcv->data = *area;
     }
 
   if (is_zip)
     {
-      if (log_unzip (redo_unzip_ptr, rcv->length, (char *) rcv->data))
+      if (!log_unzip (redo_unzip_ptr, rcv->length, (char *) rcv->data))
 	{
-	  if ((undo_length > 0) && (undo_data != NULL))
-	    {
-	      (void) log_diff (undo_length, undo_data, redo_unzip_ptr->data_length, redo_unzip_ptr->log_data);
-	      rcv->length = (int) redo_unzip_ptr->data_length;
-	      rcv->data = (char *) redo_unzip_ptr->log_data;
-	    }
-	  else
-	    {
-	      rcv->length = (int) redo_unzip_ptr->data_length;
-	      rcv->data = (char *) redo_unzip_ptr->log_data;
-	    }
+	  return ER_FAILED;
 	}
-      else
+      if ((undo_length > 0) && (undo_data != NULL))
+	{
+	  (void) log_diff (undo_length, undo_data, redo_unzip_ptr->data_length, redo_unzip_ptr->log_data);
+	}
+      rcv->length = (int) redo_unzip_ptr->data_length;
+      rcv->data = (char *) redo_unzip_ptr->log_data;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * log_rv_redo_record - EXECUTE A REDO RECORD
+ *
+ * return: nothing
+ *
+ *   log_lsa(in/out): Log address identifier containing the log record
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side
+ *               effect to the page where data ends)
+ *   redofun(in): Function to invoke to redo the data
+ *   rcv(in/out): Recovery structure for recovery function(Set as a side
+ *               effect)
+ *   rcv_lsa_ptr(in): Reset data page (rcv->pgptr) to this LSA
+ *   ignore_redofunc(in):
+ *   undo_length(in):
+ *   undo_data(in):
+ *   redo_unzip_ptr(in):
+ *
+ * NOTE: Execute a redo log record.
+ */
+static void
+log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
+		    int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv, LOG_LSA * rcv_lsa_ptr,
+		    int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr)
+{
+  char *area = NULL;
+  int error_code;
+
+  /* Note the the data page rcv->pgptr has been fetched by the caller */
+
+  if (log_rv_get_redo_data (thread_p, log_lsa, log_page_p, rcv, undo_length, undo_data, redo_unzip_ptr, &area)
+      != NO_ERROR)
+    {
+      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
+      if (area != NULL)
 	{
-	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
+	  free_and_init (area);
 	}
+      return;
     }
 
   if (redofun != NULL)
@@ -532,6 +715,572 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
     }
 }
 
+/*
+ * log_rv_redo_is_parallel - CHECK IF REDO RECORD CAN BE APPLIED BY PARALLEL REDO WORKERS
+ *
+ * return: true if record must be dispatched to workers, false if it must be applied by recovery thread
+ *
+ *   parallel_redo(in): parallel redo or NULL if redo is sequential
+ *   rcv_vpid(in): page of redo record
+ *   rcvindex(in): recovery index of redo record
+ *
+ * NOTE: When the record must be applied by recovery thread, wait for the workers to apply all dispatched records.
+ */
+static bool
+log_rv_redo_is_parallel (log_rv_parallel_redo * parallel_redo, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex)
+{
+  if (parallel_redo == NULL)
+    {
+      return false;
+    }
+
+  if (rcv_vpid->pageid != NULL_PAGEID && rcv_vpid->volid != NULL_VOLID && !RCV_IS_NEW_PAGE_INIT (rcvindex)
+      && !(rcvindex >= RVDK_NEWVOL && rcvindex <= RVDK_VOLHEAD_EXPAND)
+      && !(rcvindex >= RVVAC_COMPLETE && rcvindex <= RVVAC_REMOVE_OVF_INSID))
+    {
+      /* Redo is confined to the page of the record. */
+      return true;
+    }
+
+  parallel_redo->wait_for_idle ();
+  return false;
+}
+
+/*
+ * log_rv_redo_dispatch - DISPATCH A REDO RECORD TO PARALLEL REDO WORKERS
+ *
+ * return: nothing
+ *
+ *   parallel_redo(in): parallel redo
+ *   log_lsa(in/out): Log address identifier where redo data starts (Set as a side effect to where data ends)
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side effect to the page where data ends)
+ *   rcv_vpid(in): page of redo record
+ *   dirty_page(in): entry of page in dirty page table (may be NULL)
+ *   rcvindex(in): recovery index of redo record
+ *   is_compensate(in): true to apply undo function of a compensate record
+ *   rcv(in): recovery structure (offset, length and mvcc_id are used)
+ *   rcv_lsa(in): address of redo record
+ *   undo_length(in): length of undo data, for diff records
+ *   undo_data(in): undo data, for diff records
+ *   redo_unzip_ptr(in): buffer to uncompress redo data
+ */
+static void
+log_rv_redo_dispatch (THREAD_ENTRY * thread_p, log_rv_parallel_redo * parallel_redo, LOG_LSA * log_lsa,
+		      LOG_PAGE * log_page_p, const VPID * rcv_vpid, log_rv_dirty_page * dirty_page, LOG_RCVINDEX rcvindex,
+		      bool is_compensate, LOG_RCV * rcv, const LOG_LSA * rcv_lsa, int undo_length, char *undo_data,
+		      LOG_ZIP * redo_unzip_ptr)
+{
+  log_rv_redo_job *job;
+  char *area = NULL;
+
+  if (log_rv_get_redo_data (thread_p, log_lsa, log_page_p, rcv, undo_length, undo_data, redo_unzip_ptr, &area)
+      != NO_ERROR)
+    {
+      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rv_redo_dispatch");
+      if (area != NULL)
+	{
+	  free_and_init (area);
+	}
+      return;
+    }
+
+  // *INDENT-OFF*
+  job = new log_rv_redo_job ();
+  job->vpid = *rcv_vpid;
+  job->dirty_page = dirty_page;
+  job->rcv_lsa = *rcv_lsa;
+  job->rcvindex = rcvindex;
+  job->is_compensate = is_compensate;
+  job->offset = rcv->offset;
+  job->mvcc_id = rcv->mvcc_id;
+  job->data.assign (rcv->data, rcv->data + rcv->length);
+  // *INDENT-ON*
+
+  if (area != NULL)
+    {
+      free_and_init (area);
+    }
+
+  parallel_redo->dispatch (job);
+}
+
+/*
+ * log_rv_analysis_dirty_page - REGISTER THE PAGE OF A REDO RECORD IN DIRTY PAGE TABLE
+ *
+ * return: nothing
+ *
+ *   log_type(in): log record type
+ *   log_lsa(in): address of log record
+ *   log_page_p(in): log page of log record
+ *   dirty_pages(in/out): dirty page table
+ *
+ * NOTE: The log position of the analysis is not changed. If the data header is found on next log page, the page is
+ *       read into the buffer of the dirty page table.
+ */
+static void
+log_rv_analysis_dirty_page (THREAD_ENTRY * thread_p, LOG_RECTYPE log_type, const LOG_LSA * log_lsa,
+			    LOG_PAGE * log_page_p, log_rv_dirty_page_table * dirty_pages)
+{
+  LOG_LSA data_lsa;
+  LOG_DATA *data;
+  VPID vpid;
+  int data_header_size;
+
+  if (dirty_pages == NULL || dirty_pages->is_dropped ())
+    {
+      return;
+    }
+
+  switch (log_type)
+    {
+    case LOG_UNDOREDO_DATA:
+    case LOG_DIFF_UNDOREDO_DATA:
+      data_header_size = sizeof (LOG_REC_UNDOREDO);
+      break;
+    case LOG_MVCC_UNDOREDO_DATA:
+    case LOG_MVCC_DIFF_UNDOREDO_DATA:
+      data_header_size = sizeof (LOG_REC_MVCC_UNDOREDO);
+      break;
+    case LOG_REDO_DATA:
+      data_header_size = sizeof (LOG_REC_REDO);
+      break;
+    case LOG_MVCC_REDO_DATA:
+      data_header_size = sizeof (LOG_REC_MVCC_REDO);
+      break;
+    case LOG_RUN_POSTPONE:
+      data_header_size = sizeof (LOG_REC_RUN_POSTPONE);
+      break;
+    case LOG_COMPENSATE:
+      data_header_size = sizeof (LOG_REC_COMPENSATE);
+      break;
+    default:
+      /* no page is redone */
+      return;
+    }
+
+  /* All these data headers start with LOG_DATA. Find it the way LOG_READ_ADD_ALIGN and
+   * LOG_READ_ADVANCE_WHEN_DOESNT_FIT do, without changing the page of the analysis. */
+  data_lsa = *log_lsa;
+  data_lsa.offset = DB_ALIGN (data_lsa.offset + sizeof (LOG_RECORD_HEADER), DOUBLE_ALIGNMENT);
+  if (data_lsa.offset >= (int) LOGAREA_SIZE)
+    {
+      data_lsa.pageid++;
+      data_lsa.offset = DB_ALIGN (data_lsa.offset - (int) LOGAREA_SIZE, DOUBLE_ALIGNMENT);
+    }
+  else if (data_lsa.offset + data_header_size >= (int) LOGAREA_SIZE)
+    {
+      data_lsa.pageid++;
+      data_lsa.offset = 0;
+    }
+
+  if (data_lsa.pageid != log_lsa->pageid)
+    {
+      log_page_p = dirty_pages->get_log_page_buffer ();
+      if (logpb_fetch_page (thread_p, &data_lsa, LOG_CS_FORCE_USE, log_page_p) != NO_ERROR)
+	{
+	  /* the record is not registered; the table cannot be trusted for skipping records */
+	  er_clear ();
+	  dirty_pages->set_incomplete ();
+	  return;
+	}
+    }
+
+  data = (LOG_DATA *) ((char *) log_page_p->area + data_lsa.offset);
+  vpid.volid = data->volid;
+  vpid.pageid = data->pageid;
+  if (VPID_ISNULL (&vpid))
+    {
+      /* logical record */
+      return;
+    }
+
+  // *INDENT-OFF*
+  dirty_pages->add (vpid, *log_lsa);
+  // *INDENT-ON*
+}
+
+/*
+ * log_rv_find_dirty_page - find page in dirty page table
+ *
+ * return: entry of page or NULL
+ *
+ *   dirty_pages(in): dirty page table (may be NULL)
+ *   vpid(in): page identifier
+ */
+static log_rv_dirty_page *
+log_rv_find_dirty_page (log_rv_dirty_page_table * dirty_pages, const VPID * vpid)
+{
+  if (dirty_pages == NULL || VPID_ISNULL (vpid))
+    {
+      return NULL;
+    }
+  return dirty_pages->find (*vpid);
+}
+
+/*
+ * log_rv_check_redo_covered - mark page as covered if its LSA is not older than its last analysed redo record
+ *
+ * return: nothing
+ *
+ *   dirty_page(in/out): entry of page in dirty page table (may be NULL)
+ *   page_lsa(in): current LSA of the page
+ *
+ * NOTE: Once covered, the remaining redo records of the page are skipped without fixing the page. Page LSA only
+ *       grows during redo, so the page keeps covering them.
+ */
+static void
+log_rv_check_redo_covered (log_rv_dirty_page * dirty_page, const LOG_LSA * page_lsa)
+{
+  if (dirty_page != NULL && !dirty_page->is_redo_covered && LSA_LE (&dirty_page->last_lsa, page_lsa))
+    {
+      dirty_page->is_redo_covered = true;
+    }
+}
+
+// *INDENT-OFF*
+void
+log_rv_redo_context::on_create (context_type &context)
+{
+  context.claim_system_worker ();
+}
+
+void
+log_rv_redo_context::on_retire (context_type &context)
+{
+  context.retire_system_worker ();
+}
+
+void
+log_rv_redo_context::on_recycle (context_type &context)
+{
+  context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+}
+
+log_rv_redo_task::log_rv_redo_task (log_rv_redo_partition &partition)
+  : m_partition (partition)
+{
+}
+
+void
+log_rv_redo_task::execute (cubthread::entry &thread_ref)
+{
+  log_rv_redo_job *job;
+
+  while (true)
+    {
+      {
+        std::unique_lock<std::mutex> ulock (m_partition.m_mutex);
+        m_partition.m_cond.wait (ulock, [this] { return !m_partition.m_jobs.empty () || m_partition.m_stop; });
+        if (m_partition.m_jobs.empty ())
+          {
+            /* stopped and nothing left to apply */
+            return;
+          }
+        job = m_partition.m_jobs.front ();
+        m_partition.m_jobs.pop_front ();
+        m_partition.m_is_applying = true;
+      }
+      /* wake up recovery thread if it waits for room in queue */
+      m_partition.m_cond.notify_all ();
+
+      apply (thread_ref, *job);
+      delete job;
+
+      {
+        std::unique_lock<std::mutex> ulock (m_partition.m_mutex);
+        m_partition.m_is_applying = false;
+      }
+      m_partition.m_cond.notify_all ();
+    }
+}
+
+void
+log_rv_redo_task::apply (cubthread::entry &thread_ref, const log_rv_redo_job &job)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  LOG_RCV rcv;
+  int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *);
+  int error_code;
+
+  rcv.pgptr = log_rv_redo_fix_page (thread_p, &job.vpid, job.rcvindex);
+  if (rcv.pgptr == NULL)
+    {
+      /* deallocated */
+      return;
+    }
+
+  log_rv_check_redo_covered (job.dirty_page, pgbuf_get_lsa (rcv.pgptr));
+  if (LSA_LE (&job.rcv_lsa, pgbuf_get_lsa (rcv.pgptr)))
+    {
+      /* It is already done */
+      pgbuf_unfix (thread_p, rcv.pgptr);
+      return;
+    }
+
+  rcv.mvcc_id = job.mvcc_id;
+  rcv.offset = job.offset;
+  rcv.length = (int) job.data.size ();
+  rcv.data = job.data.data ();
+  LSA_SET_NULL (&rcv.reference_lsa);
+
+  redofun = job.is_compensate ? RV_fun[job.rcvindex].undofun : RV_fun[job.rcvindex].redofun;
+  if (redofun != NULL)
+    {
+      error_code = (*redofun) (thread_p, &rcv);
+      if (error_code != NO_ERROR)
+        {
+          logpb_fatal_error (thread_p, true, ARG_FILE_LINE,
+                             "log_rv_redo_task: Error applying redo record at log_lsa=(%lld, %d), "
+                             "rcv = {mvccid=%llu, vpid=(%d, %d), offset = %d, data_length = %d}",
+                             (long long int) job.rcv_lsa.pageid, (int) job.rcv_lsa.offset,
+                             (long long int) rcv.mvcc_id, (int) job.vpid.pageid, (int) job.vpid.volid,
+                             (int) rcv.offset, (int) rcv.length);
+        }
+    }
+  else
+    {
+      er_log_debug (ARG_FILE_LINE, "log_rv_redo_task: WARNING.. There is not a"
+                    " REDO function to execute. May produce recovery problems.");
+    }
+
+  (void) pgbuf_set_lsa (thread_p, rcv.pgptr, &job.rcv_lsa);
+  pgbuf_unfix (thread_p, rcv.pgptr);
+}
+
+log_rv_parallel_redo::log_rv_parallel_redo (size_t worker_count)
+  : m_context ()
+  , m_workpool (NULL)
+  , m_partitions (worker_count)
+{
+}
+
+log_rv_parallel_redo::~log_rv_parallel_redo ()
+{
+  if (m_workpool == NULL)
+    {
+      return;
+    }
+
+  wait_for_idle ();
+  for (log_rv_redo_partition &partition : m_partitions)
+    {
+      {
+        std::unique_lock<std::mutex> ulock (partition.m_mutex);
+        partition.m_stop = true;
+      }
+      partition.m_cond.notify_all ();
+    }
+  thread_get_manager ()->destroy_worker_pool (m_workpool);
+}
+
+//
+// start - create workers, one for each partition. returns false if workers are not available and redo must be done
+//         by recovery thread.
+//
+bool
+log_rv_parallel_redo::start ()
+{
+#if defined (SERVER_MODE)
+  m_workpool = thread_get_manager ()->create_worker_pool (m_partitions.size (), m_partitions.size (),
+                                                          "log recovery redo pool", &m_context, 1, false);
+  if (m_workpool == NULL)
+    {
+      return false;
+    }
+
+  for (log_rv_redo_partition &partition : m_partitions)
+    {
+      thread_get_manager ()->push_task (m_workpool, new log_rv_redo_task (partition));
+    }
+  return true;
+#else // not SERVER_MODE = SA_MODE
+  // no worker pools in stand-alone mode
+  return false;
+#endif // not SERVER_MODE = SA_MODE
+}
+
+//
+// dispatch - queue job to the partition of its page. recovery thread is blocked while the queue is full, so it does
+//            not read the log too far ahead of the workers.
+//
+void
+log_rv_parallel_redo::dispatch (log_rv_redo_job *job)
+{
+  size_t hash = (size_t) job->vpid.volid * 31 + (size_t) job->vpid.pageid;
+  log_rv_redo_partition &partition = m_partitions[hash % m_partitions.size ()];
+
+  {
+    std::unique_lock<std::mutex> ulock (partition.m_mutex);
+    partition.m_cond.wait (ulock, [&partition] { return partition.m_jobs.size () < LOG_RV_REDO_MAX_QUEUED_JOBS; });
+    partition.m_jobs.push_back (job);
+  }
+  partition.m_cond.notify_all ();
+}
+
+//
+// wait_for_idle - wait until all dispatched jobs are applied
+//
+void
+log_rv_parallel_redo::wait_for_idle ()
+{
+  for (log_rv_redo_partition &partition : m_partitions)
+    {
+      std::unique_lock<std::mutex> ulock (partition.m_mutex);
+      partition.m_cond.wait (ulock, [&partition] { return partition.m_jobs.empty () && !partition.m_is_applying; });
+    }
+}
+
+log_rv_dirty_page::log_rv_dirty_page (const VPID &vpid_arg, const LOG_LSA &lsa_arg)
+  : vpid (vpid_arg)
+  , first_lsa (lsa_arg)
+  , last_lsa (lsa_arg)
+  , is_redo_covered (false)
+{
+}
+
+size_t
+log_rv_vpid_hash::operator() (const VPID &vpid) const
+{
+  return ((size_t) vpid.volid << 32) ^ (size_t) (unsigned int) vpid.pageid;
+}
+
+bool
+log_rv_vpid_equal::operator() (const VPID &left, const VPID &right) const
+{
+  return VPID_EQ (&left, &right);
+}
+
+log_rv_dirty_page_table::log_rv_dirty_page_table ()
+  : m_pages ()
+  , m_page_map ()
+  , m_redo_index (0)
+  , m_prefetch_index (0)
+  , m_max_pages ((size_t) prm_get_integer_value (PRM_ID_PB_NBUFFERS))
+  , m_is_complete (true)
+  , m_is_dropped (false)
+{
+}
+
+//
+// add - register redo record of page. records are added in LSA order. when the table would grow past m_max_pages, it
+//       is released and no longer used.
+//
+void
+log_rv_dirty_page_table::add (const VPID &vpid, const LOG_LSA &rcv_lsa)
+{
+  if (m_is_dropped)
+    {
+      return;
+    }
+
+  auto it = m_page_map.find (vpid);
+  if (it != m_page_map.end ())
+    {
+      it->second->last_lsa = rcv_lsa;
+      return;
+    }
+
+  if (m_pages.size () >= m_max_pages)
+    {
+      er_log_debug (ARG_FILE_LINE, "log_rv_dirty_page_table: more than %zu pages are redone; dropping the table.\n",
+                    m_max_pages);
+
+      std::deque<log_rv_dirty_page> ().swap (m_pages);
+      decltype (m_page_map) ().swap (m_page_map);
+      m_redo_index = m_prefetch_index = 0;
+      m_is_complete = false;
+      m_is_dropped = true;
+      return;
+    }
+
+  m_pages.emplace_back (vpid, rcv_lsa);
+  m_page_map.emplace (vpid, &m_pages.back ());
+}
+
+//
+// set_incomplete - some redo record could not be registered; records may no longer be skipped based on the table
+//
+void
+log_rv_dirty_page_table::set_incomplete ()
+{
+  m_is_complete = false;
+}
+
+bool
+log_rv_dirty_page_table::is_dropped () const
+{
+  return m_is_dropped;
+}
+
+//
+// find - get entry of page. it is safe to call concurrently once the analysis is over.
+//
+log_rv_dirty_page *
+log_rv_dirty_page_table::find (const VPID &vpid)
+{
+  if (!m_is_complete)
+    {
+      return NULL;
+    }
+
+  auto it = m_page_map.find (vpid);
+  return it != m_page_map.end () ? it->second : NULL;
+}
+
+//
+// prefetch - ask for pages needed by the redo records following redo_lsa. pages are requested in batches, when half of
+//            the prefetch window was consumed, sorted and merged in ranges of consecutive pages.
+//
+void
+log_rv_dirty_page_table::prefetch (const LOG_LSA &redo_lsa)
+{
+  std::vector<VPID> batch;
+  size_t end_index;
+  size_t i, run;
+
+  while (m_redo_index < m_pages.size () && LSA_LE (&m_pages[m_redo_index].first_lsa, &redo_lsa))
+    {
+      m_redo_index++;
+    }
+  m_prefetch_index = std::max (m_prefetch_index, m_redo_index);
+
+  if (m_prefetch_index >= m_pages.size () || m_prefetch_index - m_redo_index >= LOG_RV_PREFETCH_WINDOW / 2)
+    {
+      return;
+    }
+
+  end_index = std::min (m_redo_index + LOG_RV_PREFETCH_WINDOW, m_pages.size ());
+  batch.reserve (end_index - m_prefetch_index);
+  for (; m_prefetch_index < end_index; m_prefetch_index++)
+    {
+      batch.push_back (m_pages[m_prefetch_index].vpid);
+    }
+
+  std::sort (batch.begin (), batch.end (), [] (const VPID &left, const VPID &right)
+    {
+      return left.volid < right.volid || (left.volid == right.volid && left.pageid < right.pageid);
+    });
+
+  for (i = 0; i < batch.size (); i += run)
+    {
+      for (run = 1; i + run < batch.size (); run++)
+        {
+          if (batch[i + run].volid != batch[i].volid || batch[i + run].pageid != batch[i].pageid + (PAGEID) run)
+            {
+              break;
+            }
+        }
+      fileio_prefetch_pages (fileio_get_volume_descriptor (batch[i].volid), batch[i].pageid, (int) run, IO_PAGESIZE);
+    }
+}
+
+LOG_PAGE *
+log_rv_dirty_page_table::get_log_page_buffer ()
+{
+  return (LOG_PAGE *) PTR_ALIGN (m_log_pgbuf, MAX_ALIGNMENT);
+}
+// *INDENT-ON*
+
 /*
  * log_rv_find_checkpoint - FIND RECOVERY CHECKPOINT
  *
@@ -658,6 +1407,9 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
   int tran_index;
   INT64 num_redo_log_records;
   int error_code = NO_ERROR;
+  // *INDENT-OFF*
+  std::unique_ptr<log_rv_dirty_page_table> dirty_pages (new log_rv_dirty_page_table ());
+  // *INDENT-ON*
 
   assert (LOG_CS_OWN_WRITE_MODE (thread_p));
 
@@ -729,7 +1481,7 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
 
   log_Gl.rcv_phase = LOG_RECOVERY_ANALYSIS_PHASE;
   log_recovery_analysis (thread_p, &rcv_lsa, &start_redolsa, &end_redo_lsa, ismedia_crash, stopat, &did_incom_recovery,
-			 &num_redo_log_records);
+			 &num_redo_log_records, dirty_pages.get ());
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_STARTED, 3, num_redo_log_records,
 	  start_redolsa.pageid, end_redo_lsa.pageid);
@@ -768,7 +1520,8 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
 
   LOG_SET_CURRENT_TRAN_INDEX (thread_p, rcv_tran_index);
 
-  log_recovery_redo (thread_p, &start_redolsa, &end_redo_lsa, stopat);
+  log_recovery_redo (thread_p, &start_redolsa, &end_redo_lsa, stopat, dirty_pages.get ());
+  dirty_pages.reset ();
   boot_reset_db_parm (thread_p);
 
   /* Undo phase */
@@ -2412,7 +3165,8 @@ log_is_page_of_record_broken (THREAD_ENTRY * thread_p, const LOG_LSA * log_lsa,
 
 static void
 log_recovery_analysis (THREAD_ENTRY * thread_p, LOG_LSA * start_lsa, LOG_LSA * start_redo_lsa, LOG_LSA * end_redo_lsa,
-		       bool is_media_crash, time_t * stop_at, bool * did_incom_recovery, INT64 * num_redo_log_records)
+		       bool is_media_crash, time_t * stop_at, bool * did_incom_recovery, INT64 * num_redo_log_records,
+		       log_rv_dirty_page_table * dirty_pages)
 {
   LOG_LSA checkpoint_lsa = { -1, -1 };
   LOG_LSA lsa;			/* LSA of log record to analyse */
@@ -2821,6 +3575,7 @@ log_recovery_analysis (THREAD_ENTRY * thread_p, LOG_LSA * start_lsa, LOG_LSA * s
 		}
 	    }
 
+	  log_rv_analysis_dirty_page (thread_p, log_rtype, &log_lsa, log_page_p, dirty_pages);
 	  log_rv_analysis_record (thread_p, log_rtype, tran_id, &log_lsa, log_page_p, &checkpoint_lsa, &prev_lsa,
 				  start_lsa, start_redo_lsa, is_media_crash, stop_at, did_incom_recovery,
 				  &may_use_checkpoint, &may_need_synch_checkpoint_2pc);
@@ -3033,7 +3788,7 @@ log_recovery_needs_skip_logical_redo (THREAD_ENTRY * thread_p, TRANID tran_id, L
  */
 static void
 log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const LOG_LSA * end_redo_lsa,
-		   time_t * stopat)
+		   time_t * stopat, log_rv_dirty_page_table * dirty_pages)
 {
   LOG_LSA lsa;			/* LSA of log record to redo */
   char log_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_log_pgbuf;
@@ -3072,6 +3827,11 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   LOG_ZIP *redo_unzip_ptr = NULL;
   bool is_diff_rec;
   bool is_mvcc_op = false;
+  bool is_parallel;
+  log_rv_dirty_page *dirty_page;
+  // *INDENT-OFF*
+  std::unique_ptr<log_rv_parallel_redo> parallel_redo;
+  // *INDENT-ON*
 
   aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
@@ -3113,6 +3873,18 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
       return;
     }
 
+  if (prm_get_integer_value (PRM_ID_RECOVERY_PARALLEL_COUNT) > 0)
+    {
+      // *INDENT-OFF*
+      parallel_redo.reset (new log_rv_parallel_redo (prm_get_integer_value (PRM_ID_RECOVERY_PARALLEL_COUNT)));
+      // *INDENT-ON*
+      if (!parallel_redo->start ())
+	{
+	  /* Workers are not available; redo records sequentially. */
+	  parallel_redo.reset ();
+	}
+    }
+
   while (!LSA_ISNULL (&lsa))
     {
       /* Fetch the page where the LSA record to undo is located */
@@ -3205,6 +3977,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      break;
 	    }
 
+	  if (dirty_pages != NULL)
+	    {
+	      // *INDENT-OFF*
+	      dirty_pages->prefetch (log_lsa);
+	      // *INDENT-ON*
+	    }
+
 	  switch (log_rtype)
 	    {
 	    case LOG_MVCC_UNDOREDO_DATA:
@@ -3285,8 +4064,15 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = undoredo->data.rcvindex;
+	      dirty_page = log_rv_find_dirty_page (dirty_pages, &rcv_vpid);
+	      if (dirty_page != NULL && dirty_page->is_redo_covered)
+		{
+		  /* The page is known to be already updated by this record. */
+		  break;
+		}
+	      is_parallel = log_rv_redo_is_parallel (parallel_redo.get (), &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_parallel && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3299,6 +4085,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      if (rcv.pgptr != NULL)
 		{
 		  rcv_page_lsaptr = pgbuf_get_lsa (rcv.pgptr);
+		  log_rv_check_redo_covered (dirty_page, rcv_page_lsaptr);
 		  /*
 		   * Do we need to execute the redo operation ?
 		   * If page_lsa >= lsa... already updated. In this case make sure
@@ -3395,7 +4182,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      if (is_diff_rec)
+	      if (is_parallel)
+		{
+		  log_rv_redo_dispatch (thread_p, parallel_redo.get (), &log_lsa, log_pgptr, &rcv_vpid, dirty_page,
+					rcvindex, false, &rcv, &rcv_lsa, is_diff_rec ? (int) undo_unzip_ptr->data_length : 0,
+					is_diff_rec ? (char *) undo_unzip_ptr->log_data : NULL, redo_unzip_ptr);
+		}
+	      else if (is_diff_rec)
 		{
 		  /* XOR Process */
 		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa,
@@ -3471,8 +4264,15 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = redo->data.rcvindex;
+	      dirty_page = log_rv_find_dirty_page (dirty_pages, &rcv_vpid);
+	      if (dirty_page != NULL && dirty_page->is_redo_covered)
+		{
+		  /* The page is known to be already updated by this record. */
+		  break;
+		}
+	      is_parallel = log_rv_redo_is_parallel (parallel_redo.get (), &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_parallel && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3485,6 +4285,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      if (rcv.pgptr != NULL)
 		{
 		  rcv_page_lsaptr = pgbuf_get_lsa (rcv.pgptr);
+		  log_rv_check_redo_covered (dirty_page, rcv_page_lsaptr);
 		  /*
 		   * Do we need to execute the redo operation ?
 		   * If page_lsa >= rcv_lsa... already updated
@@ -3528,6 +4329,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      if (is_parallel)
+		{
+		  log_rv_redo_dispatch (thread_p, parallel_redo.get (), &log_lsa, log_pgptr, &rcv_vpid, dirty_page,
+					rcvindex, false, &rcv, &rcv_lsa, 0, NULL, redo_unzip_ptr);
+		  break;
+		}
+
 	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
 				  redo_unzip_ptr);
 
@@ -3567,6 +4375,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      if (!log_recovery_needs_skip_logical_redo (thread_p, tran_id, log_rtype, rcvindex, &rcv_lsa))
 		{
+		  /* Logical redo; dispatched records must be applied first. */
+		  (void) log_rv_redo_is_parallel (parallel_redo.get (), &rcv_vpid, rcvindex);
 		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
 				      NULL);
 		}
@@ -3593,8 +4403,15 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = run_posp->data.rcvindex;
+	      dirty_page = log_rv_find_dirty_page (dirty_pages, &rcv_vpid);
+	      if (dirty_page != NULL && dirty_page->is_redo_covered)
+		{
+		  /* The page is known to be already updated by this record. */
+		  break;
+		}
+	      is_parallel = log_rv_redo_is_parallel (parallel_redo.get (), &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_parallel && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3607,6 +4424,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      if (rcv.pgptr != NULL)
 		{
 		  rcv_page_lsaptr = pgbuf_get_lsa (rcv.pgptr);
+		  log_rv_check_redo_covered (dirty_page, rcv_page_lsaptr);
 		  /*
 		   * Do we need to execute the redo operation ?
 		   * If page_lsa >= rcv_lsa... already updated
@@ -3651,6 +4469,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      if (is_parallel)
+		{
+		  rcv.mvcc_id = MVCCID_NULL;
+		  log_rv_redo_dispatch (thread_p, parallel_redo.get (), &log_lsa, log_pgptr, &rcv_vpid, dirty_page,
+					rcvindex, false, &rcv, &rcv_lsa, 0, NULL, NULL);
+		  break;
+		}
+
 	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
 				  NULL);
 
@@ -3680,8 +4506,15 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = compensate->data.rcvindex;
+	      dirty_page = log_rv_find_dirty_page (dirty_pages, &rcv_vpid);
+	      if (dirty_page != NULL && dirty_page->is_redo_covered)
+		{
+		  /* The page is known to be already updated by this record. */
+		  break;
+		}
+	      is_parallel = log_rv_redo_is_parallel (parallel_redo.get (), &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_parallel && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3694,6 +4527,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	      if (rcv.pgptr != NULL)
 		{
 		  rcv_page_lsaptr = pgbuf_get_lsa (rcv.pgptr);
+		  log_rv_check_redo_covered (dirty_page, rcv_page_lsaptr);
 		  /*
 		   * Do we need to execute the redo operation ?
 		   * If page_lsa >= rcv_lsa... already updated
@@ -3737,6 +4571,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      if (is_parallel)
+		{
+		  rcv.mvcc_id = MVCCID_NULL;
+		  log_rv_redo_dispatch (thread_p, parallel_redo.get (), &log_lsa, log_pgptr, &rcv_vpid, dirty_page,
+					rcvindex, true, &rcv, &rcv_lsa, 0, NULL, NULL);
+		  break;
+		}
+
 	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_lsa, 0, NULL,
 				  NULL);
 	      if (rcv.pgptr != NULL)
@@ -4031,6 +4873,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	}
     }
 
+  if (parallel_redo != NULL)
+    {
+      /* All dispatched records must be applied before finishing postpones and flushing pages. */
+      parallel_redo->wait_for_idle ();
+      parallel_redo.reset ();
+    }
+
   log_zip_free (undo_unzip_ptr);
   log_zip_free (redo_unzip_ptr);
 
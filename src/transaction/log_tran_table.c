@@ -1471,6 +1471,7 @@ logtb_free_tran_mvcc_info (LOG_TDES * tdes)
   MVCC_INFO *curr_mvcc_info = &tdes->mvccinfo;
 
   curr_mvcc_info->snapshot.m_active_mvccs.finalize ();
+  curr_mvcc_info->snapshot.has_trans_status_copy = false;
   curr_mvcc_info->sub_ids.clear ();
 }
 
@@ -4591,6 +4592,8 @@ logtb_complete_sub_mvcc (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
 	  MVCCID_FORWARD (snapshot->highest_completed_mvccid);
 	}
       snapshot->m_active_mvccs.set_inactive_mvccid (mvcc_sub_id);
+      /* the copy no longer matches the status it was taken from */
+      snapshot->has_trans_status_copy = false;
     }
 }
 
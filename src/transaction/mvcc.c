@@ -647,6 +647,8 @@ mvcc_snapshot::mvcc_snapshot ()
   , m_active_mvccs ()
   , snapshot_fnc (NULL)
   , valid (false)
+  , trans_status_version (0)
+  , has_trans_status_copy (false)
 {
 }
 
@@ -657,7 +659,7 @@ mvcc_snapshot::reset ()
   lowest_active_mvccid = MVCCID_NULL;
   highest_completed_mvccid = MVCCID_NULL;
 
-  m_active_mvccs.reset ();
+  // m_active_mvccs is not cleared; mvcctable::build_mvcc_info may reuse it if transaction status does not change
 
   valid = false;
 }
@@ -672,6 +674,8 @@ mvcc_snapshot::copy_to (mvcc_snapshot & dest) const
   dest.highest_completed_mvccid = highest_completed_mvccid;
   dest.snapshot_fnc = snapshot_fnc;
   dest.valid = valid;
+  dest.trans_status_version = trans_status_version;
+  dest.has_trans_status_copy = has_trans_status_copy;
 }
 
 mvcc_info::mvcc_info ()
@@ -178,6 +178,11 @@ struct mvcc_snapshot
 
   bool valid;			/* true, if the snapshot is valid */
 
+  /* version of the transaction status m_active_mvccs was copied from. the copy outlives the snapshot and is reused by
+   * next snapshots of the same transaction descriptor, as long as no transaction completes in between */
+  UINT64 trans_status_version;
+  bool has_trans_status_copy;	/* true, if m_active_mvccs holds the status of trans_status_version */
+
   // *INDENT-OFF*
   mvcc_snapshot ();
   void reset ();
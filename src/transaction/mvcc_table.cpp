@@ -236,6 +236,7 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
   TSCTIMEVAL tv_diff;
   UINT64 snapshot_wait_time;
   UINT64 snapshot_retry_count = 0;
+  bool is_reused = false;
 
   assert (tdes.tran_index >= 0 && tdes.tran_index < logtb_get_number_of_total_tran_indices ());
 
@@ -296,6 +297,17 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       const mvcc_trans_status &trans_status = m_trans_status_history[index];
 
       trans_status_version = trans_status.m_version.load ();
+
+      if (tdes.mvccinfo.snapshot.has_trans_status_copy
+	  && tdes.mvccinfo.snapshot.trans_status_version == trans_status_version)
+	{
+	  // no transaction completed since the previous snapshot of this descriptor was built. status versions are
+	  // unique, so the copy it kept is identical to the current status and does not need to be copied again.
+	  is_reused = true;
+	  break;
+	}
+
+      tdes.mvccinfo.snapshot.has_trans_status_copy = false;
       trans_status.m_active_mvccs.copy_to (tdes.mvccinfo.snapshot.m_active_mvccs,
 					   mvcc_active_tran::copy_safety::THREAD_UNSAFE);
       /* load statistics temporary disabled need to be enabled when activate count optimization */
@@ -311,6 +323,8 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       if (trans_status_version == trans_status.m_version.load ())
 	{
 	  // no version change; copying status was successful
+	  tdes.mvccinfo.snapshot.trans_status_version = trans_status_version;
+	  tdes.mvccinfo.snapshot.has_trans_status_copy = true;
 	  break;
 	}
       else
@@ -350,6 +364,10 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
 	  perfmon_add_stat (thread_get_thread_entry_info (), PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS,
 			    snapshot_retry_count - 1);
 	}
+      if (is_reused)
+	{
+	  perfmon_inc_stat (thread_get_thread_entry_info (), PSTAT_LOG_SNAPSHOT_REUSE_COUNTERS);
+	}
     }
 }
 
@@ -605,6 +623,8 @@ mvcctable::reset_start_mvccid ()
 
   assert (m_trans_status_history_position < HISTORY_MAX_SIZE);
   m_trans_status_history[m_trans_status_history_position].m_active_mvccs.reset_start_mvccid (log_Gl.hdr.mvcc_next_id);
+  // status changed in place; new version so copies kept by snapshots are not reused
+  m_trans_status_history[m_trans_status_history_position].m_version.store (++m_current_trans_status.m_version);
 
   m_current_status_lowest_active_mvccid.store (log_Gl.hdr.mvcc_next_id);
 }
@@ -32,6 +32,7 @@
 #include "storage_common.h"
 
 #include <atomic>
+#include <cstdint>
 #include <mutex>
 
 // forward declarations
@@ -40,7 +41,7 @@ struct mvcc_info;
 
 struct mvcc_trans_status
 {
-  using version_type = unsigned int;
+  using version_type = std::uint64_t;   // never wraps; each version identifies one transaction status
 
   enum event_type
   {
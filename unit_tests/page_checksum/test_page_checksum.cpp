@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "test_page_checksum.hpp"
+
+#include "file_io.h"
+#include "storage_common.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace test_page_checksum
+{
+
+  /* allocate a page as the page buffer would flush it: initialized reserved areas and some user data */
+  static FILEIO_PAGE *
+  create_page (void)
+  {
+    FILEIO_PAGE *io_page = (FILEIO_PAGE *) malloc (IO_PAGESIZE);
+    if (io_page == NULL)
+      {
+	return NULL;
+      }
+
+    memset (io_page, 0, IO_PAGESIZE);
+    fileio_initialize_res (NULL, io_page, IO_PAGESIZE);
+    io_page->prv.volid = 0;
+    io_page->prv.pageid = 100;
+    for (int i = 0; i < DB_PAGESIZE; i++)
+      {
+	io_page->page[i] = (char) (i * 31 + 7);
+      }
+
+    return io_page;
+  }
+
+  static bool
+  is_page_corrupted (FILEIO_PAGE *io_page)
+  {
+    bool is_corrupted = true;
+
+    (void) fileio_page_check_corruption (NULL, io_page, &is_corrupted);
+    return is_corrupted;
+  }
+
+  int test_checksum_round_trip (void)
+  {
+    int res = 0;
+    FILEIO_PAGE *io_page = create_page ();
+
+    if (io_page == NULL)
+      {
+	return -1;
+      }
+
+    fileio_enable_page_checksum (true);
+    (void) fileio_set_page_checksum (NULL, io_page);
+
+    if (io_page->prv.checksum == 0)
+      {
+	std::cout << " checksum was not set" << std::endl;
+	res = -1;
+	assert (false);
+      }
+    if (!fileio_is_page_checksum_valid (io_page) || is_page_corrupted (io_page))
+      {
+	std::cout << " checksum of unchanged page does not match" << std::endl;
+	res = -1;
+	assert (false);
+      }
+
+    /* setting it again over the stored checksum gives the same value */
+    INT32 checksum = io_page->prv.checksum;
+    (void) fileio_set_page_checksum (NULL, io_page);
+    if (io_page->prv.checksum != checksum)
+      {
+	std::cout << " checksum depends on the previous checksum" << std::endl;
+	res = -1;
+	assert (false);
+      }
+
+    fileio_enable_page_checksum (false);
+    free (io_page);
+    return res;
+  }
+
+  int test_checksum_mismatch (void)
+  {
+    int res = 0;
+    FILEIO_PAGE *io_page = create_page ();
+
+    if (io_page == NULL)
+      {
+	return -1;
+      }
+
+    fileio_enable_page_checksum (true);
+    (void) fileio_set_page_checksum (NULL, io_page);
+
+    /* a single changed byte in the user area */
+    io_page->page[DB_PAGESIZE / 2] ^= 0x1;
+    if (fileio_is_page_checksum_valid (io_page) || !is_page_corrupted (io_page))
+      {
+	std::cout << " changed user data was not detected" << std::endl;
+	res = -1;
+	assert (false);
+      }
+    io_page->page[DB_PAGESIZE / 2] ^= 0x1;
+
+    /* a changed page header */
+    io_page->prv.pageid++;
+    if (fileio_is_page_checksum_valid (io_page))
+      {
+	std::cout << " changed page header was not detected" << std::endl;
+	res = -1;
+	assert (false);
+      }
+    io_page->prv.pageid--;
+
+    /* a corrupted checksum */
+    io_page->prv.checksum ^= 0x100;
+    if (fileio_is_page_checksum_valid (io_page))
+      {
+	std::cout << " corrupted checksum was not detected" << std::endl;
+	res = -1;
+	assert (false);
+      }
+    io_page->prv.checksum ^= 0x100;
+
+    if (!fileio_is_page_checksum_valid (io_page))
+      {
+	std::cout << " restored page does not match" << std::endl;
+	res = -1;
+	assert (false);
+      }
+
+    fileio_enable_page_checksum (false);
+    free (io_page);
+    return res;
+  }
+
+  int test_checksum_disabled (void)
+  {
+    int res = 0;
+    FILEIO_PAGE *io_page = create_page ();
+
+    if (io_page == NULL)
+      {
+	return -1;
+      }
+
+    /* a page written by a database formatted with checksums, then flushed again without them */
+    fileio_enable_page_checksum (true);
+    (void) fileio_set_page_checksum (NULL, io_page);
+    fileio_enable_page_checksum (false);
+
+    io_page->page[0] ^= 0x1;
+    (void) fileio_set_page_checksum (NULL, io_page);
+    if (io_page->prv.checksum != 0)
+      {
+	std::cout << " stale checksum was kept" << std::endl;
+	res = -1;
+	assert (false);
+      }
+
+    /* pages without checksum are always accepted */
+    if (!fileio_is_page_checksum_valid (io_page) || is_page_corrupted (io_page))
+      {
+	std::cout << " page without checksum was rejected" << std::endl;
+	res = -1;
+	assert (false);
+      }
+
+    free (io_page);
+    return res;
+  }
+
+} /* namespace test_page_checksum */